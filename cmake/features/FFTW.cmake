@@ -1,5 +1,7 @@
 ### FFTW ...
 
+set( atlas_HAVE_FFTW_SINGLE 0 )
+
 if( atlas_HAVE_ATLAS_TRANS )
 
 ecbuild_add_option( FEATURE FFTW
@@ -9,6 +11,16 @@ ecbuild_add_option( FEATURE FFTW
 if( NOT HAVE_FFTW )
     unset( FFTW_LIBRARIES )
     unset( FFTW_INCLUDES )
+else()
+    # Single precision FFTW (fftw3f) is optional, and used for single precision transforms
+    set( _atlas_FFTW_LIBRARIES ${FFTW_LIBRARIES} )
+    find_package( FFTW COMPONENTS double single QUIET )
+    if( FFTW_FOUND )
+        set( atlas_HAVE_FFTW_SINGLE 1 )
+    else()
+        set( FFTW_LIBRARIES ${_atlas_FFTW_LIBRARIES} )
+    endif()
+    unset( _atlas_FFTW_LIBRARIES )
 endif()
 
-endif()
\ No newline at end of file
+endif()
@@ -90,6 +90,18 @@ void FunctionSpace::haloExchange(const FieldSet& fields, bool on_device) const {
     get()->haloExchange(fields, on_device);
 }
 
+parallel::HaloExchangeHandle FunctionSpace::haloExchangeStart(const FieldSet& fields, bool on_device) const {
+    return get()->haloExchangeStart(fields, on_device);
+}
+
+parallel::HaloExchangeHandle FunctionSpace::haloExchangeStart(const Field& field, bool on_device) const {
+    return get()->haloExchangeStart(field, on_device);
+}
+
+void FunctionSpace::haloExchangeFinish(parallel::HaloExchangeHandle& handle) const {
+    get()->haloExchangeFinish(handle);
+}
+
 void FunctionSpace::adjointHaloExchange(const FieldSet& fields, bool on_device) const {
     get()->adjointHaloExchange(fields, on_device);
 }
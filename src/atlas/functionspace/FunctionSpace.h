@@ -13,6 +13,7 @@
 #include <string>
 
 #include "atlas/library/config.h"
+#include "atlas/parallel/HaloExchangeHandle.h"
 #include "atlas/util/ObjectHandle.h"
 
 namespace eckit {
@@ -64,6 +65,16 @@ public:
     void haloExchange(const FieldSet&, bool on_device = false) const;
     void haloExchange(const Field&, bool on_device = false) const;
 
+    /// @brief Start a non-blocking halo exchange
+    ///
+    /// The halos are only valid after haloExchangeFinish() has been called with the returned handle.
+    /// Function spaces without split-phase support complete the exchange immediately.
+    parallel::HaloExchangeHandle haloExchangeStart(const FieldSet&, bool on_device = false) const;
+    parallel::HaloExchangeHandle haloExchangeStart(const Field&, bool on_device = false) const;
+
+    /// @brief Complete a halo exchange started with haloExchangeStart()
+    void haloExchangeFinish(parallel::HaloExchangeHandle&) const;
+
     void adjointHaloExchange(const FieldSet&, bool on_device = false) const;
     void adjointHaloExchange(const Field&, bool on_device = false) const;
 
@@ -83,6 +83,9 @@ public:
 
     void haloExchange(const FieldSet&, bool on_device = false) const override;
     void haloExchange(const Field&, bool on_device = false) const override;
+    using FunctionSpaceImpl::haloExchangeStart;
+    parallel::HaloExchangeHandle haloExchangeStart(const FieldSet&, bool on_device = false) const override;
+    void haloExchangeFinish(parallel::HaloExchangeHandle&) const override;
     const parallel::HaloExchange& halo_exchange() const;
 
     void adjointHaloExchange(const FieldSet&, bool on_device = false) const override;
@@ -10,6 +10,9 @@
  */
 
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -22,8 +25,10 @@
 #include "atlas/grid/Iterator.h"
 #include "atlas/option/Options.h"
 #include "atlas/parallel/HaloExchange.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
 #include "atlas/util/KDTree.h"
 #include "atlas/util/CoordinateEnums.h"
 #include "atlas/util/Metadata.h"
@@ -133,6 +138,36 @@ PointCloud::PointCloud(const FieldSet& flds, const eckit::Configuration& config)
     }
 }
 
+// Straight line distance, consistent with distances in util::KDTree
+static double chord_distance(const PointXYZ& a, const PointXYZ& b) {
+    const double dx = a[XX] - b[XX];
+    const double dy = a[YY] - b[YY];
+    const double dz = a[ZZ] - b[ZZ];
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+// Global indices (1-based) and interleaved lonlat of the grid points owned by given partition.
+// Only the ranges of the distribution assigned to the partition are visited.
+static void compute_owned_points(const Grid& grid, const grid::Distribution& distribution, int part,
+                                 std::vector<gidx_t>& glb_idx, std::vector<double>& lonlat) {
+    std::vector<gidx_t> range_begin;
+    std::vector<gidx_t> range_end;
+    distribution.ranges(part, range_begin, range_end);
+    size_t size = 0;
+    for (size_t r = 0; r < range_begin.size(); ++r) {
+        size += size_t(range_end[r] - range_begin[r]);
+    }
+    glb_idx.resize(size);
+    lonlat.resize(2 * size);
+    size_t j = 0;
+    for (size_t r = 0; r < range_begin.size(); ++r) {
+        grid.compute_lonlat(range_begin[r], range_end[r], lonlat.data() + 2 * j);
+        for (gidx_t g = range_begin[r]; g < range_end[r]; ++g, ++j) {
+            glb_idx[j] = g + 1;
+        }
+    }
+}
+
 grid::Partitioner make_partitioner(const Grid& grid, const eckit::Configuration& config) {
     auto mpi_comm = get_mpi_comm(config);
     auto partitioner = grid.partitioner();
@@ -183,89 +218,182 @@ PointCloud::PointCloud(const Grid& grid, const grid::Partitioner& _partitioner,
         array::make_view<int,1>(ghost_).assign(0);
         array::make_view<int,1>(partition_).assign(part_);
 
-        idx_t j{0};
-        gidx_t g{0};
-        for (auto p : grid.lonlat()) {
-            if( distribution.partition(g) == part_ ) {
-                gidx(j) = g+1;
-                ridx(j) = j;
-                lonlat(j, 0) = p.lon();
-                lonlat(j, 1) = p.lat();
-                ++j;
-            }
-            ++g;
+        std::vector<gidx_t> owned_glb_idx;
+        std::vector<double> owned_lonlat;
+        compute_owned_points(grid, distribution, part_, owned_glb_idx, owned_lonlat);
+        ATLAS_ASSERT(owned_glb_idx.size() == size_t(size_owned));
+        for (idx_t j = 0; j < size_owned; ++j) {
+            gidx(j) = owned_glb_idx[j];
+            ridx(j) = j;
+            lonlat(j, 0) = owned_lonlat[2 * j];
+            lonlat(j, 1) = owned_lonlat[2 * j + 1];
         }
     }
     else {
 
-        std::vector<int> keep;
+        // The halo is built from neighbouring partitions only: each partition publishes a bounding
+        // sphere of its owned points, and sends the points which could be within halo_radius of
+        // another partition's owned points to that partition. Memory and work per partition therefore
+        // scale with the size of the partition rather than with the size of the grid.
+        const Geometry geometry(config.getString("geometry", "Earth"));
+        max_glb_idx_ = grid.size();
+
+        std::vector<PointLonLat> owned_lonlat;
+        std::vector<PointXYZ> owned_xyz;
+        std::vector<gidx_t> owned_glb_idx;
+        {
+            ATLAS_TRACE("collect owned points");
+            std::vector<double> lonlat;
+            compute_owned_points(grid, distribution, part_, owned_glb_idx, lonlat);
+            ATLAS_ASSERT(owned_glb_idx.size() == size_t(size_owned));
+            owned_lonlat.resize(owned_glb_idx.size());
+            for (size_t j = 0; j < owned_lonlat.size(); ++j) {
+                owned_lonlat[j] = PointLonLat{lonlat[2 * j], lonlat[2 * j + 1]};
+            }
+            owned_xyz.resize(owned_lonlat.size());
+            atlas_omp_parallel_for(size_t j = 0; j < owned_lonlat.size(); ++j) {
+                geometry.lonlat2xyz(owned_lonlat[j], owned_xyz[j]);
+            }
+        }
+
+        // Bounding spheres {x,y,z,radius} of all partitions, radius < 0 for an empty partition
+        std::vector<double> spheres(4 * nb_partitions_);
+        {
+            ATLAS_TRACE("bounding spheres");
+            std::vector<double> sphere{0., 0., 0., -1.};
+            if (not owned_xyz.empty()) {
+                for (const auto& xyz : owned_xyz) {
+                    sphere[XX] += xyz[XX];
+                    sphere[YY] += xyz[YY];
+                    sphere[ZZ] += xyz[ZZ];
+                }
+                for (int d = 0; d < 3; ++d) {
+                    sphere[d] /= double(owned_xyz.size());
+                }
+                const PointXYZ centre{sphere[XX], sphere[YY], sphere[ZZ]};
+                for (const auto& xyz : owned_xyz) {
+                    sphere[3] = std::max(sphere[3], chord_distance(centre, xyz));
+                }
+            }
+            eckit::mpi::Buffer<double> recv(nb_partitions_);
+            ATLAS_TRACE_MPI(ALLGATHER) { comm.allGatherv(sphere.begin(), sphere.end(), recv); }
+            std::copy(recv.buffer.begin(), recv.buffer.end(), spheres.begin());
+        }
 
+        // Send owned points to each partition whose owned points they may be in the halo of
+        std::vector<std::vector<gidx_t>> recv_glb_idx(nb_partitions_);
+        std::vector<std::vector<double>> recv_lonlat(nb_partitions_);
         {
-            ATLAS_TRACE("Build list of points to keep");
-            std::vector<PointLonLat> owned_lonlat;
-            std::vector<idx_t> owned_grid_idx;
-            owned_lonlat.reserve(size_owned);
-            owned_grid_idx.reserve(size_owned);
-
-            auto kdtree = util::IndexKDTree(config);
-            {
-                ATLAS_TRACE("build kdtree");
-                kdtree.reserve(grid.size());
-                idx_t j{0};
-                for (auto p : grid.lonlat()) {
-                    if( distribution.partition(j) == part_ ) {
-                        owned_lonlat.emplace_back(p);
-                        owned_grid_idx.emplace_back(j);
+            ATLAS_TRACE("exchange candidate halo points");
+            std::vector<std::vector<gidx_t>> send_glb_idx(nb_partitions_);
+            std::vector<std::vector<double>> send_lonlat(nb_partitions_);
+            const double* my_sphere = spheres.data() + 4 * part_;
+            for (idx_t q = 0; q < nb_partitions_; ++q) {
+                const double* sphere = spheres.data() + 4 * q;
+                if (q == part_ || sphere[3] < 0. || my_sphere[3] < 0.) {
+                    continue;
+                }
+                const PointXYZ centre{sphere[XX], sphere[YY], sphere[ZZ]};
+                const PointXYZ my_centre{my_sphere[XX], my_sphere[YY], my_sphere[ZZ]};
+                const double reach = sphere[3] + halo_radius;
+                if (chord_distance(centre, my_centre) > my_sphere[3] + reach) {
+                    continue;
+                }
+                for (size_t j = 0; j < owned_xyz.size(); ++j) {
+                    if (chord_distance(centre, owned_xyz[j]) <= reach) {
+                        send_glb_idx[q].emplace_back(owned_glb_idx[j]);
+                        send_lonlat[q].emplace_back(owned_lonlat[j].lon());
+                        send_lonlat[q].emplace_back(owned_lonlat[j].lat());
                     }
-                    kdtree.insert(p,j);
-                    ++j;
+                }
+            }
+            ATLAS_TRACE_MPI(ALLTOALL) {
+                comm.allToAll(send_glb_idx, recv_glb_idx);
+                comm.allToAll(send_lonlat, recv_lonlat);
+            }
+        }
+
+        // Keep received points within halo_radius of an owned point, searching a kd-tree of owned points only
+        std::vector<PointLonLat> halo_lonlat;
+        std::vector<gidx_t> halo_glb_idx;
+        std::vector<int> halo_partition;
+        {
+            ATLAS_TRACE("search kdtree");
+            std::vector<PointLonLat> candidate_lonlat;
+            std::vector<gidx_t> candidate_glb_idx;
+            std::vector<int> candidate_partition;
+            for (idx_t q = 0; q < nb_partitions_; ++q) {
+                for (size_t j = 0; j < recv_glb_idx[q].size(); ++j) {
+                    candidate_lonlat.emplace_back(recv_lonlat[q][2 * j + 0], recv_lonlat[q][2 * j + 1]);
+                    candidate_glb_idx.emplace_back(recv_glb_idx[q][j]);
+                    candidate_partition.emplace_back(q);
+                }
+            }
+
+            const size_t nb_candidates = candidate_lonlat.size();
+            std::vector<idx_t> nearest(nb_candidates);
+            std::vector<double> distance(nb_candidates, std::numeric_limits<double>::max());
+            if (nb_candidates > 0 && not owned_xyz.empty()) {
+                auto kdtree = util::IndexKDTree(geometry);
+                kdtree.reserve(owned_xyz.size());
+                for (size_t j = 0; j < owned_xyz.size(); ++j) {
+                    kdtree.insert(owned_xyz[j], idx_t(j));
                 }
                 kdtree.build();
+                kdtree.closestPoints(candidate_lonlat.data(), nb_candidates, 1, nearest.data(), distance.data());
             }
 
-            keep.resize(grid.size());
-            {
-                ATLAS_TRACE("search kdtree");
-                for (idx_t j=0; j<size_owned; ++j) {
-                    idx_t idx = owned_grid_idx[j];
-                    const auto& p = owned_lonlat[j];
-                    auto points = kdtree.closestPointsWithinRadius(p,halo_radius).payloads();
-                    for( idx_t jj: points ) {
-                        keep[jj] = 1;
-                    }
+            std::vector<size_t> halo;
+            for (size_t j = 0; j < nb_candidates; ++j) {
+                if (distance[j] <= halo_radius) {
+                    halo.emplace_back(j);
                 }
             }
+            std::sort(halo.begin(), halo.end(),
+                      [&](size_t a, size_t b) { return candidate_glb_idx[a] < candidate_glb_idx[b]; });
+            for (size_t j : halo) {
+                halo_lonlat.emplace_back(candidate_lonlat[j]);
+                halo_glb_idx.emplace_back(candidate_glb_idx[j]);
+                halo_partition.emplace_back(candidate_partition[j]);
+            }
         }
 
         {
             ATLAS_TRACE("create fields");
 
-            auto size_halo = std::accumulate(keep.begin(),keep.end(),0);
+            idx_t size_halo = static_cast<idx_t>(owned_lonlat.size() + halo_lonlat.size());
 
             lonlat_         = Field("lonlat", array::make_datatype<double>(), array::make_shape(size_halo, 2));
             partition_      = Field("partition", array::make_datatype<int>(), array::make_shape(size_halo));
             ghost_          = Field("ghost", array::make_datatype<int>(), array::make_shape(size_halo));
             global_index_   = Field("global_index", array::make_datatype<gidx_t>(), array::make_shape(size_halo));
-            max_glb_idx_    = grid.size();
             auto lonlat     = array::make_view<double,2>(lonlat_);
             auto partition  = array::make_view<int,1>(partition_);
             auto ghost      = array::make_view<int,1>(ghost_);
             auto glb_idx    = array::make_view<gidx_t,1>(global_index_);
 
-            gidx_t g=0;
-            idx_t j = 0;
-            for (auto p : grid.lonlat()) {
-                if (keep[g]) {
-                    lonlat(j, 0) = p.lon();
-                    lonlat(j, 1) = p.lat();
-                    partition(j) = distribution.partition(g);
-                    ghost(j) = partition(j) != part_;
-                    glb_idx(j) = g+1;
-                    ++j;
+            // Merge owned and halo points, both sorted by global index
+            size_t jo = 0;
+            size_t jh = 0;
+            for (idx_t j = 0; j < size_halo; ++j) {
+                if (jh == halo_glb_idx.size() ||
+                    (jo < owned_glb_idx.size() && owned_glb_idx[jo] < halo_glb_idx[jh])) {
+                    lonlat(j, 0) = owned_lonlat[jo].lon();
+                    lonlat(j, 1) = owned_lonlat[jo].lat();
+                    partition(j) = part_;
+                    ghost(j)     = 0;
+                    glb_idx(j)   = owned_glb_idx[jo];
+                    ++jo;
+                }
+                else {
+                    lonlat(j, 0) = halo_lonlat[jh].lon();
+                    lonlat(j, 1) = halo_lonlat[jh].lat();
+                    partition(j) = halo_partition[jh];
+                    ghost(j)     = 1;
+                    glb_idx(j)   = halo_glb_idx[jh];
+                    ++jh;
                 }
-                ++g;
             }
-
         }
 
     }
@@ -533,26 +661,6 @@ template class PointCloud::IteratorT<PointLonLat>;
 
 namespace {
 
-template <int RANK>
-void dispatch_haloExchange(Field& field, const parallel::HaloExchange& halo_exchange, bool on_device) {
-    if (field.datatype() == array::DataType::kind<int>()) {
-        halo_exchange.template execute<int, RANK>(field.array(), on_device);
-    }
-    else if (field.datatype() == array::DataType::kind<long>()) {
-        halo_exchange.template execute<long, RANK>(field.array(), on_device);
-    }
-    else if (field.datatype() == array::DataType::kind<float>()) {
-        halo_exchange.template execute<float, RANK>(field.array(), on_device);
-    }
-    else if (field.datatype() == array::DataType::kind<double>()) {
-        halo_exchange.template execute<double, RANK>(field.array(), on_device);
-    }
-    else {
-        throw_Exception("datatype not supported", Here());
-    }
-    field.set_dirty(false);
-}
-
 template <int RANK>
 void dispatch_adjointHaloExchange(Field& field, const parallel::HaloExchange& halo_exchange, bool on_device) {
     if (field.datatype() == array::DataType::kind<int>()) {
@@ -576,27 +684,20 @@ void dispatch_adjointHaloExchange(Field& field, const parallel::HaloExchange& ha
 }  // namespace
 
 void PointCloud::haloExchange(const FieldSet& fieldset, bool on_device) const {
+    auto handle = haloExchangeStart(fieldset, on_device);
+    haloExchangeFinish(handle);
+}
+
+parallel::HaloExchangeHandle PointCloud::haloExchangeStart(const FieldSet& fieldset, bool on_device) const {
     if (halo_exchange_) {
-        for (idx_t f = 0; f < fieldset.size(); ++f) {
-            Field& field = const_cast<FieldSet&>(fieldset)[f];
-            switch (field.rank()) {
-                case 1:
-                    dispatch_haloExchange<1>(field, halo_exchange(), on_device);
-                    break;
-                case 2:
-                    dispatch_haloExchange<2>(field, halo_exchange(), on_device);
-                   break;
-                case 3:
-                    dispatch_haloExchange<3>(field, halo_exchange(), on_device);
-                    break;
-                case 4:
-                    dispatch_haloExchange<4>(field, halo_exchange(), on_device);
-                    break;
-                default:
-                    throw_Exception("Rank not supported", Here());
-            }
-            field.set_dirty(false);
-        }
+        return startHaloExchange(halo_exchange(), fieldset, on_device);
+    }
+    return parallel::HaloExchangeHandle();
+}
+
+void PointCloud::haloExchangeFinish(parallel::HaloExchangeHandle& handle) const {
+    if (handle.active()) {
+        halo_exchange().finish(handle);
     }
 }
 
@@ -10,9 +10,11 @@
 
 #include "FunctionSpaceImpl.h"
 #include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
 #include "atlas/option/Options.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/util/Metadata.h"
+#include "atlas/parallel/HaloExchange.h"
 #include "atlas/parallel/mpi/mpi.h"
 
 namespace atlas {
@@ -38,6 +40,38 @@ void FunctionSpaceImpl::haloExchange(const Field&, bool) const {
     ATLAS_NOTIMPLEMENTED;
 }
 
+parallel::HaloExchangeHandle FunctionSpaceImpl::haloExchangeStart(const FieldSet& fieldset, bool on_device) const {
+    // Without a split-phase implementation, the exchange is completed here
+    haloExchange(fieldset, on_device);
+    return parallel::HaloExchangeHandle();
+}
+
+parallel::HaloExchangeHandle FunctionSpaceImpl::haloExchangeStart(const Field& field, bool on_device) const {
+    FieldSet fieldset;
+    fieldset.add(field);
+    return haloExchangeStart(fieldset, on_device);
+}
+
+void FunctionSpaceImpl::haloExchangeFinish(parallel::HaloExchangeHandle& handle) const {
+    ATLAS_ASSERT(not handle.active());
+}
+
+parallel::HaloExchangeHandle FunctionSpaceImpl::startHaloExchange(const parallel::HaloExchange& halo_exchange,
+                                                                  const FieldSet& fieldset, bool on_device) const {
+    std::vector<array::Array*> arrays;
+    arrays.reserve(fieldset.size());
+    for (idx_t f = 0; f < fieldset.size(); ++f) {
+        arrays.emplace_back(&const_cast<FieldSet&>(fieldset)[f].array());
+    }
+    auto handle = halo_exchange.start(arrays, on_device);
+    handle.on_finish([fieldset]() {
+        for (idx_t f = 0; f < fieldset.size(); ++f) {
+            const_cast<FieldSet&>(fieldset)[f].set_dirty(false);
+        }
+    });
+    return handle;
+}
+
 void FunctionSpaceImpl::adjointHaloExchange(const FieldSet&, bool) const {
     ATLAS_NOTIMPLEMENTED;
 }
@@ -14,6 +14,7 @@
 #include <type_traits>
 #include <vector>
 
+#include "atlas/parallel/HaloExchangeHandle.h"
 #include "atlas/util/Object.h"
 
 #include "atlas/library/config.h"
@@ -33,6 +34,7 @@ class PartitionPolygons;
 }  // namespace util
 namespace parallel {
 class GatherScatter;
+class HaloExchange;
 }  // namespace parallel
 
 }  // namespace atlas
@@ -79,6 +81,10 @@ public:
     virtual void haloExchange(const FieldSet&, bool /*on_device*/ = false) const;
     virtual void haloExchange(const Field&, bool /* on_device*/ = false) const;
 
+    virtual parallel::HaloExchangeHandle haloExchangeStart(const FieldSet&, bool /*on_device*/ = false) const;
+    parallel::HaloExchangeHandle haloExchangeStart(const Field&, bool on_device = false) const;
+    virtual void haloExchangeFinish(parallel::HaloExchangeHandle&) const;
+
     virtual void adjointHaloExchange(const FieldSet&, bool /*on_device*/ = false) const;
     virtual void adjointHaloExchange(const Field&, bool /* on_device*/ = false) const;
 
@@ -115,6 +121,13 @@ public:
 
     virtual std::string mpi_comm() const;
 
+protected:
+    /// @brief Start exchanging the halos of all fields in the fieldset with given halo exchange
+    ///
+    /// The fields are marked clean once the returned handle is finished.
+    parallel::HaloExchangeHandle startHaloExchange(const parallel::HaloExchange&, const FieldSet&,
+                                                   bool on_device) const;
+
 private:
     util::Metadata* metadata_;
 };
@@ -11,8 +11,10 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdarg>
+#include <cstdint>
 #include <functional>
 #include <limits>
+#include <type_traits>
 
 #include "atlas/array.h"
 #include "atlas/field/Field.h"
@@ -97,6 +99,176 @@ inline double sqr(const double& val) {
 }
 }  // namespace
 
+namespace {
+
+/// Sums which do not depend on the order in which values are added, nor on the partitioning.
+///
+/// Floating point values are accumulated exactly in a fixed-point number covering the full range of
+/// double precision, stored as 32-bit digits in 64-bit integers. Partial sums of threads and MPI tasks
+/// are combined by adding digits, which is exact, so that the distributed sum needs a single allreduce.
+/// The result is rounded to the value type only at the end.
+template <typename T, bool = std::is_floating_point<T>::value>
+class ReproducibleSum {
+public:
+    explicit ReproducibleSum(idx_t size): digits_(size * nb_digits, 0), nonfinite_(size, 0.) {}
+
+    void add(idx_t i, T value) {
+        const double x = value;
+        if (not std::isfinite(x)) {
+            nonfinite_[i] += x;
+            return;
+        }
+        if (x == 0.) {
+            return;
+        }
+        // |x| = m * 2^(exponent-53), with m an integer of at most 53 bits
+        int exponent;
+        const auto m    = static_cast<std::uint64_t>(std::ldexp(std::frexp(std::abs(x), &exponent), 53));
+        const int p     = exponent - 53 - min_exponent;
+        const int shift = p % digit_bits;
+        const auto lo   = (m & digit_mask) << shift;  // < 2^63
+        const auto hi   = (m >> digit_bits) << shift;  // < 2^52
+        const auto sign = std::int64_t(x < 0. ? -1 : 1);
+        std::int64_t* d = digits_.data() + i * nb_digits + p / digit_bits;
+        d[0] += sign * std::int64_t(lo & digit_mask);
+        d[1] += sign * std::int64_t((lo >> digit_bits) + (hi & digit_mask));
+        d[2] += sign * std::int64_t(hi >> digit_bits);
+        if (++pending_ == max_pending) {
+            normalise();
+        }
+    }
+
+    void add(ReproducibleSum& other) {
+        other.normalise();
+        normalise();
+        for (size_t k = 0; k < digits_.size(); ++k) {
+            digits_[k] += other.digits_[k];
+        }
+        for (size_t i = 0; i < nonfinite_.size(); ++i) {
+            nonfinite_[i] += other.nonfinite_[i];
+        }
+        normalise();
+    }
+
+    void allReduce(const eckit::mpi::Comm& comm) {
+        normalise();
+        comm.allReduceInPlace(digits_.data(), digits_.size(), eckit::mpi::sum());
+        comm.allReduceInPlace(nonfinite_.data(), nonfinite_.size(), eckit::mpi::sum());
+        normalise();
+    }
+
+    std::vector<T> values() {
+        normalise();
+        std::vector<T> result(nonfinite_.size());
+        for (size_t i = 0; i < result.size(); ++i) {
+            result[i] = nonfinite_[i] != 0. ? static_cast<T>(nonfinite_[i]) : static_cast<T>(value(i));
+        }
+        return result;
+    }
+
+private:
+    static constexpr int digit_bits           = 32;
+    static constexpr std::uint64_t digit_mask = (std::uint64_t(1) << digit_bits) - 1;
+    // Digit k has weight 2^(min_exponent + 32 k). The range covers m * 2^(exponent-53) for subnormals
+    // (down to 2^-1126) up to the largest double (below 2^1024), with headroom for carries.
+    static constexpr int min_exponent         = -1152;
+    static constexpr int nb_digits            = 72;
+    static constexpr std::int64_t max_pending = std::int64_t(1) << 29;  // additions before digits may overflow
+
+    // Propagate carries such that all digits but the most significant one are in [0, 2^32)
+    void normalise() {
+        for (size_t i = 0; i < nonfinite_.size(); ++i) {
+            normalise(digits_.data() + i * nb_digits);
+        }
+        pending_ = 0;
+    }
+
+    static void normalise(std::int64_t d[]) {
+        for (int k = 0; k < nb_digits - 1; ++k) {
+            const std::int64_t carry = (d[k] - (d[k] & std::int64_t(digit_mask))) / (std::int64_t(1) << digit_bits);
+            d[k] -= carry * (std::int64_t(1) << digit_bits);
+            d[k + 1] += carry;
+        }
+    }
+
+    // Requires normalised digits, of which the most significant one carries the sign
+    double value(size_t i) const {
+        std::vector<std::int64_t> d(digits_.begin() + i * nb_digits, digits_.begin() + (i + 1) * nb_digits);
+        const bool negative = d[nb_digits - 1] < 0;
+        if (negative) {
+            for (auto& digit : d) {
+                digit = -digit;
+            }
+            normalise(d.data());
+        }
+        double result = 0.;
+        for (int k = 0; k < nb_digits; ++k) {
+            result += std::ldexp(static_cast<double>(d[k]), min_exponent + k * digit_bits);
+        }
+        return negative ? -result : result;
+    }
+
+    std::vector<std::int64_t> digits_;
+    std::vector<double> nonfinite_;  // sum of infinite and NaN values, which cannot be represented by digits_
+    std::int64_t pending_{0};
+};
+
+/// Integer sums are exact, and therefore reproducible, as long as they do not overflow
+template <typename T>
+class ReproducibleSum<T, false> {
+public:
+    explicit ReproducibleSum(idx_t size): sums_(size, 0) {}
+
+    void add(idx_t i, T value) { sums_[i] += value; }
+
+    void add(ReproducibleSum& other) {
+        for (size_t i = 0; i < sums_.size(); ++i) {
+            sums_[i] += other.sums_[i];
+        }
+    }
+
+    void allReduce(const eckit::mpi::Comm& comm) {
+        comm.allReduceInPlace(sums_.data(), sums_.size(), eckit::mpi::sum());
+    }
+
+    std::vector<T> values() { return sums_; }
+
+private:
+    std::vector<T> sums_;
+};
+
+/// Reproducible sums of the field values on the nodes owned by each task, either per level
+/// and/or per variable, or summed over those.
+template <typename T>
+std::vector<T> reproducible_sum(const NodeColumns& fs, const Field& field, bool per_level, bool per_variable) {
+    const auto arr = make_leveled_view<const T>(field);
+    const mesh::IsGhostNode is_ghost(fs.nodes());
+    const idx_t npts     = std::min(arr.shape(0), fs.nb_nodes());
+    const idx_t nlev     = arr.shape(1);
+    const idx_t nvar     = arr.shape(2);
+    const idx_t nsum_var = per_variable ? nvar : 1;
+    const idx_t nsum     = (per_level ? nlev : 1) * nsum_var;
+
+    ReproducibleSum<T> sum(nsum);
+    atlas_omp_parallel {
+        ReproducibleSum<T> sum_private(nsum);
+        atlas_omp_for(idx_t n = 0; n < npts; ++n) {
+            if (!is_ghost(n)) {
+                for (idx_t l = 0; l < nlev; ++l) {
+                    for (idx_t j = 0; j < nvar; ++j) {
+                        sum_private.add((per_level ? l * nsum_var : 0) + (per_variable ? j : 0), arr(n, l, j));
+                    }
+                }
+            }
+        }
+        atlas_omp_critical { sum.add(sum_private); }
+    }
+    ATLAS_TRACE_MPI(ALLREDUCE) { sum.allReduce(mpi::comm(fs.mpi_comm())); }
+    return sum.values();
+}
+
+}  // namespace
+
 namespace detail {  // Collectives implementation
 
 template <typename T>
@@ -300,42 +472,10 @@ void sum_per_level(const NodeColumns& fs, const Field& field, Field& sum, idx_t&
     }
 }
 
-template <typename DATATYPE>
-void dispatch_order_independent_sum_2d(const NodeColumns& fs, const Field& field, DATATYPE& result, idx_t& N) {
-    idx_t root   = 0;
-    Field global = fs.createField(field, option::global());
-    fs.gather(field, global);
-    result   = 0;
-    auto glb = array::make_view<DATATYPE, 1>(global);
-    for (idx_t jnode = 0; jnode < glb.size(); ++jnode) {
-        result += glb(jnode);
-    }
-    ATLAS_TRACE_MPI(BROADCAST) { mpi::comm(fs.mpi_comm()).broadcast(&result, 1, root); }
-    N = fs.nb_nodes_global();
-}
-
 template <typename T>
 void dispatch_order_independent_sum(const NodeColumns& fs, const Field& field, T& result, idx_t& N) {
-    if (field.levels()) {
-        auto arr = make_leveled_scalar_view<const T>(field);
-
-        Field surface_field = fs.createField<T>(option::name("surface") | option::levels(false));
-        auto surface        = array::make_view<T, 1>(surface_field);
-
-        const idx_t N0 = std::min(surface.shape(0), arr.shape(0));
-        const idx_t N1 = arr.shape(1);
-        for (idx_t n = 0; n < N0; ++n) {
-            surface(n) = 0;
-            for (idx_t l = 0; l < N1; ++l) {
-                surface(n) += arr(n, l);
-            }
-        }
-        dispatch_order_independent_sum_2d(fs, surface_field, result, N);
-        N *= arr.shape(1);
-    }
-    else {
-        dispatch_order_independent_sum_2d(fs, field, result, N);
-    }
+    result = reproducible_sum<T>(fs, field, false, false)[0];
+    N      = fs.nb_nodes_global() * std::max<idx_t>(field.levels(), 1);
 }
 
 template <typename T>
@@ -375,61 +515,10 @@ void order_independent_sum(const NodeColumns& fs, const Field& field, T& result,
     }
 }
 
-template <typename DATATYPE>
-void dispatch_order_independent_sum_2d(const NodeColumns& fs, const Field& field, std::vector<DATATYPE>& result,
-                                       idx_t& N) {
-    idx_t nvar = field.variables();
-    result.resize(nvar);
-    for (idx_t j = 0; j < nvar; ++j) {
-        result[j] = 0.;
-    }
-    Field global = fs.createField(field, option::name("global") | option::global());
-    fs.gather(field, global);
-    if (mpi::rank() == 0) {
-        const auto glb = make_surface_view<DATATYPE>(global);
-        for (idx_t n = 0; n < fs.nb_nodes_global(); ++n) {
-            for (idx_t j = 0; j < nvar; ++j) {
-                result[j] += glb(n, j);
-            }
-        }
-    }
-    idx_t root = global.metadata().get<idx_t>("owner");
-    ATLAS_TRACE_MPI(BROADCAST) { mpi::comm(fs.mpi_comm()).broadcast(result, root); }
-    N = fs.nb_nodes_global();
-}
-
 template <typename T>
 void dispatch_order_independent_sum(const NodeColumns& fs, const Field& field, std::vector<T>& result, idx_t& N) {
-    if (field.levels()) {
-        const auto arr   = make_leveled_view<const T>(field);
-        const idx_t npts = std::min(arr.shape(0), fs.nb_nodes());
-        const idx_t nlev = arr.shape(1);
-        const idx_t nvar = arr.shape(2);
-
-        Field surface_field =
-            fs.createField<T>(option::name("surface") | option::variables(nvar) | option::levels(false));
-        auto surface = make_surface_view<T>(surface_field);
-
-        atlas_omp_for(idx_t n = 0; n < npts; ++n) {
-            for (idx_t j = 0; j < nvar; ++j) {
-                surface(n, j) = 0;
-            }
-        }
-
-        for (idx_t n = 0; n < npts; ++n) {
-            for (idx_t l = 0; l < nlev; ++l) {
-                for (idx_t j = 0; j < nvar; ++j) {
-                    surface(n, j) += arr(n, l, j);
-                }
-            }
-        }
-
-        dispatch_order_independent_sum_2d(fs, surface_field, result, N);
-        N *= arr.shape(1);
-    }
-    else {
-        dispatch_order_independent_sum_2d(fs, field, result, N);
-    }
+    result = reproducible_sum<T>(fs, field, false, true);
+    N      = fs.nb_nodes_global() * std::max<idx_t>(field.levels(), 1);
 }
 
 template <typename T>
@@ -478,46 +567,12 @@ void dispatch_order_independent_sum_per_level(const NodeColumns& fs, const Field
     }
     sumfield.resize(shape);
 
-    auto sum = make_per_level_view<T>(sumfield);
+    auto sum                  = make_per_level_view<T>(sumfield);
+    const std::vector<T> sums = reproducible_sum<T>(fs, field, true, true);
+    idx_t c(0);
     for (idx_t l = 0; l < sum.shape(0); ++l) {
         for (idx_t j = 0; j < sum.shape(1); ++j) {
-            sum(l, j) = 0.;
-        }
-    }
-
-    idx_t root   = 0;
-    Field global = fs.createField(field, option::name("global") | option::global());
-
-    fs.gather(field, global);
-    if (mpi::rank() == 0) {
-        const array::LocalView<T, 3> glb = make_leveled_view<T>(global);
-
-        for (idx_t n = 0; n < glb.shape(0); ++n) {
-            for (idx_t l = 0; l < glb.shape(1); ++l) {
-                for (idx_t j = 0; j < glb.shape(2); ++j) {
-                    sum(l, j) += glb(n, l, j);
-                }
-            }
-        }
-    }
-    ATLAS_TRACE_MPI(BROADCAST) {
-        std::vector<T> sum_array(sumfield.size());
-        if (mpi::rank() == root) {
-            idx_t c(0);
-            for (idx_t l = 0; l < sum.shape(0); ++l) {
-                for (idx_t j = 0; j < sum.shape(1); ++j) {
-                    sum_array[c++] = sum(l, j);
-                }
-            }
-        }
-        mpi::comm(fs.mpi_comm()).broadcast(sum_array, root);
-        if (mpi::rank() != root) {
-            idx_t c(0);
-            for (idx_t l = 0; l < sum.shape(0); ++l) {
-                for (idx_t j = 0; j < sum.shape(1); ++j) {
-                    sum(l, j) = sum_array[c++];
-                }
-            }
+            sum(l, j) = sums[c++];
         }
     }
     N = fs.nb_nodes_global();
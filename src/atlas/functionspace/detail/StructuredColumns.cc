@@ -800,22 +800,18 @@ struct FixupHaloForVectors<3> {
 
 
 template <int RANK>
-void dispatch_haloExchange(Field& field, const parallel::HaloExchange& halo_exchange, const StructuredColumns& fs) {
+void dispatch_fixupHalo(Field& field, const StructuredColumns& fs) {
     FixupHaloForVectors<RANK> fixup_halos(fs);
     if (field.datatype() == array::DataType::kind<int>()) {
-        halo_exchange.template execute<int, RANK>(field.array(), false);
         fixup_halos.template apply<int>(field);
     }
     else if (field.datatype() == array::DataType::kind<long>()) {
-        halo_exchange.template execute<long, RANK>(field.array(), false);
         fixup_halos.template apply<long>(field);
     }
     else if (field.datatype() == array::DataType::kind<float>()) {
-        halo_exchange.template execute<float, RANK>(field.array(), false);
         fixup_halos.template apply<float>(field);
     }
     else if (field.datatype() == array::DataType::kind<double>()) {
-        halo_exchange.template execute<double, RANK>(field.array(), false);
         fixup_halos.template apply<double>(field);
     }
     else {
@@ -852,26 +848,39 @@ void dispatch_adjointHaloExchange(Field& field, const parallel::HaloExchange& ha
 }
 }  // namespace
 
-void StructuredColumns::haloExchange(const FieldSet& fieldset, bool) const {
-    for (idx_t f = 0; f < fieldset.size(); ++f) {
-        Field& field = const_cast<FieldSet&>(fieldset)[f];
-        switch (field.rank()) {
-            case 1:
-                dispatch_haloExchange<1>(field, halo_exchange(), *this);
-                break;
-            case 2:
-                dispatch_haloExchange<2>(field, halo_exchange(), *this);
-                break;
-            case 3:
-                dispatch_haloExchange<3>(field, halo_exchange(), *this);
-                break;
-            case 4:
-                dispatch_haloExchange<4>(field, halo_exchange(), *this);
-                break;
-            default:
-                throw_Exception("Rank not supported", Here());
+void StructuredColumns::haloExchange(const FieldSet& fieldset, bool on_device) const {
+    auto handle = haloExchangeStart(fieldset, on_device);
+    haloExchangeFinish(handle);
+}
+
+parallel::HaloExchangeHandle StructuredColumns::haloExchangeStart(const FieldSet& fieldset, bool) const {
+    auto handle = startHaloExchange(halo_exchange(), fieldset, false);
+    handle.on_finish([this, fieldset]() {
+        for (idx_t f = 0; f < fieldset.size(); ++f) {
+            Field& field = const_cast<FieldSet&>(fieldset)[f];
+            switch (field.rank()) {
+                case 1:
+                    dispatch_fixupHalo<1>(field, *this);
+                    break;
+                case 2:
+                    dispatch_fixupHalo<2>(field, *this);
+                    break;
+                case 3:
+                    dispatch_fixupHalo<3>(field, *this);
+                    break;
+                case 4:
+                    dispatch_fixupHalo<4>(field, *this);
+                    break;
+                default:
+                    throw_Exception("Rank not supported", Here());
+            }
         }
-    }
+    });
+    return handle;
+}
+
+void StructuredColumns::haloExchangeFinish(parallel::HaloExchangeHandle& handle) const {
+    halo_exchange().finish(handle);
 }
 
 void StructuredColumns::adjointHaloExchange(const FieldSet& fieldset, bool) const {
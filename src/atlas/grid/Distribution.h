@@ -63,6 +63,11 @@ public:
         return get()->partition(begin, end, partitions.data());
     }
 
+    /// @brief Ranges [begin[r], end[r]) of consecutive global indices (0-based) assigned to given partition
+    void ranges(int part, std::vector<gidx_t>& begin, std::vector<gidx_t>& end) const {
+        get()->ranges(part, begin, end);
+    }
+
     size_t footprint() const { return get()->footprint(); }
 
     ATLAS_ALWAYS_INLINE idx_t nb_partitions() const { return get()->nb_partitions(); }
@@ -65,6 +65,14 @@ idx_t Grid::size() const {
     return get()->size();
 }
 
+void Grid::compute_xy(idx_t begin, idx_t end, double xy[]) const {
+    get()->compute_xy(begin, end, xy);
+}
+
+void Grid::compute_lonlat(idx_t begin, idx_t end, double lonlat[]) const {
+    get()->compute_lonlat(begin, end, lonlat);
+}
+
 size_t Grid::footprint() const {
     return get()->footprint();
 }
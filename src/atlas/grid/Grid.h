@@ -88,6 +88,15 @@ public:
 
     idx_t size() const;
 
+    /// @brief Compute xy coordinates of grid points with global index in range [begin, end)
+    /// Point n is written to xy[2*(n-begin)] and xy[2*(n-begin)+1]. This avoids the per-point
+    /// cost of the iterators, and is parallelised with OpenMP.
+    void compute_xy(idx_t begin, idx_t end, double xy[]) const;
+
+    /// @brief Compute lonlat coordinates of grid points with global index in range [begin, end)
+    /// Point n is written to lonlat[2*(n-begin)] and lonlat[2*(n-begin)+1].
+    void compute_lonlat(idx_t begin, idx_t end, double lonlat[]) const;
+
     const Projection& projection() const;
     const Domain& domain() const;
     RectangularLonLatDomain lonlatBoundingBox() const;
@@ -116,6 +116,11 @@ DistributionArray::DistributionArray(int nb_partitions, partition_t&& part):
     type_    = distribution_type(nb_partitions_);
 }
 
+DistributionArray::DistributionArray(const Partitioner& partitioner, partition_t&& part):
+    DistributionArray(partitioner.nb_partitions(), std::move(part)) {
+    type_ = distribution_type(nb_partitions_, partitioner);
+}
+
 DistributionArray::~DistributionArray() = default;
 
 void DistributionArray::print(std::ostream& s) const {
@@ -39,6 +39,8 @@ public:
 
     DistributionArray(int nb_partitions, partition_t&& partition);
 
+    DistributionArray(const Partitioner&, partition_t&& partition);
+
     virtual ~DistributionArray();
 
     int partition(const gidx_t gidx) const override { return part_[gidx]; }
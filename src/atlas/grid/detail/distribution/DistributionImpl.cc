@@ -21,6 +21,30 @@
 namespace atlas {
 namespace grid {
 
+void DistributionImpl::ranges(int part, std::vector<gidx_t>& begin, std::vector<gidx_t>& end) const {
+    begin.clear();
+    end.clear();
+    constexpr gidx_t chunk = 4096;
+    std::vector<int> partitions(chunk);
+    const gidx_t npts = size();
+    for (gidx_t b = 0; b < npts; b += chunk) {
+        const gidx_t e = std::min(b + chunk, npts);
+        partition(b, e, partitions.data());
+        for (gidx_t n = b; n < e; ++n) {
+            if (partitions[n - b] != part) {
+                continue;
+            }
+            if (not end.empty() && end.back() == n) {
+                ++end.back();
+            }
+            else {
+                begin.emplace_back(n);
+                end.emplace_back(n + 1);
+            }
+        }
+    }
+}
+
 DistributionImpl* atlas__GridDistribution__new(idx_t size, int part[], int part0) {
     return new detail::distribution::DistributionArray(0, size, part, part0);
 }
@@ -64,6 +64,12 @@ public:
     virtual void hash(eckit::Hash&) const = 0;
 
     virtual void partition(gidx_t begin, gidx_t end, int partitions[]) const = 0;
+
+    /// @brief Ranges [begin[r], end[r]) of consecutive global indices (0-based) assigned to given partition
+    ///
+    /// The default implementation scans all global indices; distributions with a more compact
+    /// representation override it.
+    virtual void ranges(int part, std::vector<gidx_t>& begin, std::vector<gidx_t>& end) const;
 };
 
 
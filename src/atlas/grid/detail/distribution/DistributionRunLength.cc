@@ -0,0 +1,207 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "DistributionRunLength.h"
+
+#include <algorithm>
+#include <ostream>
+#include <set>
+
+#include "eckit/types/Types.h"
+#include "eckit/utils/Hash.h"
+
+#include "atlas/grid/Partitioner.h"
+#include "atlas/runtime/Exception.h"
+
+namespace atlas {
+namespace grid {
+namespace detail {
+namespace distribution {
+
+namespace {
+std::string distribution_type(int N, const Partitioner& p = Partitioner()) {
+    if (N == 1) {
+        return "serial";
+    }
+    if (not p) {
+        return "custom";
+    }
+    return p.type();
+}
+}  // namespace
+
+size_t DistributionRunLength::count_runs(gidx_t npts, const int part[]) {
+    size_t nb_runs = npts > 0 ? 1 : 0;
+    for (gidx_t n = 1; n < npts; ++n) {
+        if (part[n] != part[n - 1]) {
+            ++nb_runs;
+        }
+    }
+    return nb_runs;
+}
+
+bool DistributionRunLength::compresses(gidx_t npts, const int part[]) {
+    // Require at least a factor 4 reduction compared to DistributionArray
+    size_t bytes_per_run = sizeof(gidx_t) + sizeof(int);
+    return 4 * bytes_per_run * count_runs(npts, part) <= npts * sizeof(int);
+}
+
+DistributionRunLength::DistributionRunLength(const Partitioner& partitioner, gidx_t npts, const int part[]):
+    nb_partitions_(partitioner.nb_partitions()) {
+    setup(npts, part, 0);
+    type_ = distribution_type(nb_partitions_, partitioner);
+}
+
+DistributionRunLength::DistributionRunLength(int nb_partitions, gidx_t npts, const int part[], int part0):
+    nb_partitions_(nb_partitions) {
+    setup(npts, part, part0);
+    if (nb_partitions_ == 0) {
+        std::set<int> partset(run_part_.begin(), run_part_.end());
+        nb_partitions_ = static_cast<idx_t>(partset.size());
+    }
+    type_ = distribution_type(nb_partitions_);
+}
+
+DistributionRunLength::DistributionRunLength(const Partitioner& partitioner, gidx_t npts,
+                                             std::vector<gidx_t>&& run_begin, std::vector<int>&& run_part):
+    nb_partitions_(partitioner.nb_partitions()) {
+    setup(npts, std::move(run_begin), std::move(run_part));
+    type_ = distribution_type(nb_partitions_, partitioner);
+}
+
+DistributionRunLength::DistributionRunLength(int nb_partitions, gidx_t npts, std::vector<gidx_t>&& run_begin,
+                                             std::vector<int>&& run_part):
+    nb_partitions_(nb_partitions) {
+    setup(npts, std::move(run_begin), std::move(run_part));
+    if (nb_partitions_ == 0) {
+        std::set<int> partset(run_part_.begin(), run_part_.end());
+        nb_partitions_ = static_cast<idx_t>(partset.size());
+    }
+    type_ = distribution_type(nb_partitions_);
+}
+
+void DistributionRunLength::setup(gidx_t npts, const int part[], int part0) {
+    size_ = npts;
+    size_t nb_runs = count_runs(npts, part);
+    run_begin_.reserve(nb_runs);
+    run_part_.reserve(nb_runs);
+    for (gidx_t n = 0; n < npts; ++n) {
+        if (n == 0 || part[n] != part[n - 1]) {
+            run_begin_.emplace_back(n);
+            run_part_.emplace_back(part[n] - part0);
+        }
+    }
+    setup_nb_pts();
+}
+
+void DistributionRunLength::setup(gidx_t npts, std::vector<gidx_t>&& run_begin, std::vector<int>&& run_part) {
+    ATLAS_ASSERT(run_begin.size() == run_part.size());
+    ATLAS_ASSERT(npts == 0 || (not run_begin.empty() && run_begin.front() == 0));
+    size_ = npts;
+
+    // Compact in place: drop empty runs and merge consecutive runs with the same partition
+    size_t nb_runs = 0;
+    for (size_t r = 0; r < run_begin.size(); ++r) {
+        gidx_t run_end = (r + 1 < run_begin.size()) ? run_begin[r + 1] : size_;
+        ATLAS_ASSERT(run_end >= run_begin[r]);
+        if (run_end == run_begin[r]) {
+            continue;
+        }
+        if (nb_runs > 0 && run_part[nb_runs - 1] == run_part[r]) {
+            continue;
+        }
+        run_begin[nb_runs] = run_begin[r];
+        run_part[nb_runs]  = run_part[r];
+        ++nb_runs;
+    }
+    run_begin.resize(nb_runs);
+    run_part.resize(nb_runs);
+    run_begin_ = std::move(run_begin);
+    run_part_  = std::move(run_part);
+    setup_nb_pts();
+}
+
+void DistributionRunLength::setup_nb_pts() {
+    size_t nb_runs = run_part_.size();
+    int max_part = nb_partitions_ - 1;
+    for (int p : run_part_) {
+        max_part = std::max(max_part, p);
+    }
+    nb_pts_.assign(max_part + 1, 0);
+    for (size_t r = 0; r < nb_runs; ++r) {
+        gidx_t run_end = (r + 1 < nb_runs) ? run_begin_[r + 1] : size_;
+        nb_pts_[run_part_[r]] += static_cast<idx_t>(run_end - run_begin_[r]);
+    }
+    if (not nb_pts_.empty()) {
+        max_pts_ = *std::max_element(nb_pts_.begin(), nb_pts_.end());
+        min_pts_ = *std::min_element(nb_pts_.begin(), nb_pts_.end());
+    }
+}
+
+DistributionRunLength::~DistributionRunLength() = default;
+
+void DistributionRunLength::partition(gidx_t begin, gidx_t end, int partitions[]) const {
+    if (begin >= end) {
+        return;
+    }
+    ATLAS_ASSERT(begin >= 0 && end <= size_);
+    size_t run = std::upper_bound(run_begin_.begin(), run_begin_.end(), begin) - run_begin_.begin() - 1;
+    size_t i   = 0;
+    gidx_t n   = begin;
+    while (n < end) {
+        gidx_t run_end = (run + 1 < run_part_.size()) ? std::min(run_begin_[run + 1], end) : end;
+        std::fill(partitions + i, partitions + i + (run_end - n), run_part_[run]);
+        i += run_end - n;
+        n = run_end;
+        ++run;
+    }
+}
+
+void DistributionRunLength::ranges(int part, std::vector<gidx_t>& begin, std::vector<gidx_t>& end) const {
+    begin.clear();
+    end.clear();
+    const size_t nb_runs = run_part_.size();
+    for (size_t r = 0; r < nb_runs; ++r) {
+        if (run_part_[r] == part) {
+            begin.emplace_back(run_begin_[r]);
+            end.emplace_back((r + 1 < nb_runs) ? run_begin_[r + 1] : size_);
+        }
+    }
+}
+
+void DistributionRunLength::print(std::ostream& s) const {
+    auto print_partition = [&](std::ostream& s) {
+        eckit::output_list<int> list_printer(s);
+        for (gidx_t i = 0; i < size_; i++) {
+            list_printer.push_back(partition(i));
+        }
+    };
+    s << "Distribution( "
+      << "type: " << type_ << ", nb_points: " << size() << ", nb_partitions: " << nb_pts_.size()
+      << ", nb_runs: " << nb_runs() << ", parts : ";
+    print_partition(s);
+}
+
+void DistributionRunLength::hash(eckit::Hash& hash) const {
+    // Same hash as DistributionArray holding the same partitions, so that keys derived from the hash do not depend
+    // on the representation. The runs are streamed point by point without expanding them.
+    for (size_t r = 0; r < run_part_.size(); ++r) {
+        const int part       = run_part_[r];
+        const gidx_t run_end = (r + 1 < run_part_.size()) ? run_begin_[r + 1] : size_;
+        for (gidx_t n = run_begin_[r]; n < run_end; ++n) {
+            hash.add(part);
+        }
+    }
+}
+
+}  // namespace distribution
+}  // namespace detail
+}  // namespace grid
+}  // namespace atlas
@@ -0,0 +1,111 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "atlas/grid/detail/distribution/DistributionImpl.h"
+
+namespace atlas {
+namespace grid {
+class Partitioner;
+
+namespace detail {
+namespace distribution {
+
+/// @brief Distribution stored as runs of consecutive global indices with the same partition
+///
+/// Partitioners such as "equal_regions" or "checkerboard" assign long contiguous stretches of
+/// global indices to the same partition. Storing only the first global index and partition of
+/// each run makes the memory footprint depend on the number of runs rather than on the grid size.
+/// Lookup of a partition is a binary search over the runs.
+class DistributionRunLength : public DistributionImpl {
+public:
+    DistributionRunLength(const Partitioner&, gidx_t npts, const int partition[]);
+
+    DistributionRunLength(int nb_partitions, gidx_t npts, const int partition[], int part0 = 0);
+
+    /// @brief Construct from runs, given by the first global index and the partition of each run
+    ///
+    /// Runs must be sorted by increasing global index and the first run must start at 0.
+    /// Empty runs and consecutive runs with the same partition are merged.
+    DistributionRunLength(const Partitioner&, gidx_t npts, std::vector<gidx_t>&& run_begin,
+                          std::vector<int>&& run_part);
+
+    DistributionRunLength(int nb_partitions, gidx_t npts, std::vector<gidx_t>&& run_begin,
+                          std::vector<int>&& run_part);
+
+    virtual ~DistributionRunLength();
+
+    int partition(const gidx_t gidx) const override {
+        auto run = std::upper_bound(run_begin_.begin(), run_begin_.end(), gidx) - run_begin_.begin() - 1;
+        return run_part_[run];
+    }
+
+    idx_t nb_partitions() const override { return nb_partitions_; }
+
+    const std::vector<idx_t>& nb_pts() const override { return nb_pts_; }
+
+    idx_t max_pts() const override { return max_pts_; }
+    idx_t min_pts() const override { return min_pts_; }
+
+    const std::string& type() const override { return type_; }
+
+    void print(std::ostream&) const override;
+
+    size_t footprint() const override {
+        return nb_pts_.size() * sizeof(nb_pts_[0]) + run_begin_.size() * sizeof(run_begin_[0]) +
+               run_part_.size() * sizeof(run_part_[0]);
+    }
+
+    bool functional() const override { return false; }
+
+    gidx_t size() const override { return size_; }
+
+    void hash(eckit::Hash&) const override;
+
+    void partition(gidx_t begin, gidx_t end, int partitions[]) const override;
+
+    void ranges(int part, std::vector<gidx_t>& begin, std::vector<gidx_t>& end) const override;
+
+    /// @brief Number of runs of consecutive global indices with the same partition
+    size_t nb_runs() const { return run_part_.size(); }
+
+    /// @brief Count the runs in a partition array
+    static size_t count_runs(gidx_t npts, const int partition[]);
+
+    /// @brief True if run-length storage of given partition array is substantially smaller
+    ///        than storing the array itself
+    static bool compresses(gidx_t npts, const int partition[]);
+
+private:
+    void setup(gidx_t npts, const int partition[], int part0);
+    void setup(gidx_t npts, std::vector<gidx_t>&& run_begin, std::vector<int>&& run_part);
+    void setup_nb_pts();
+
+private:
+    idx_t nb_partitions_ = 0;
+    gidx_t size_         = 0;
+
+    std::vector<gidx_t> run_begin_;
+    std::vector<int> run_part_;
+    std::vector<idx_t> nb_pts_;
+    idx_t max_pts_ = 0;
+    idx_t min_pts_ = 0;
+    std::string type_;
+};
+
+}  // namespace distribution
+}  // namespace detail
+}  // namespace grid
+}  // namespace atlas
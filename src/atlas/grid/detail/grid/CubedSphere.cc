@@ -8,6 +8,7 @@
 #include "CubedSphere.h"
 
 #include <algorithm>
+#include <array>
 #include <iomanip>
 #include <limits>
 #include <numeric>
@@ -23,6 +24,7 @@
 #include "atlas/grid/detail/grid/GridFactory.h"
 #include "atlas/grid/detail/spacing/CustomSpacing.h"
 #include "atlas/grid/detail/spacing/LinearSpacing.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/projection/detail/CubedSphereProjectionBase.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
@@ -227,6 +229,51 @@ Domain CubedSphere::computeDomain() const {
 // Destructor
 CubedSphere::~CubedSphere() = default;
 
+// Compute the coordinates of a range of points in iterator order, or return false if the rows do not cover the grid
+template <typename ComputePoint>
+bool CubedSphere::compute_range(idx_t begin, idx_t end, double crd[], const ComputePoint& compute_point) const {
+    check_range(begin, end);
+
+    // Rows (t,j) in iterator order, see nextElement(): each row runs from i=0 to imax_[t][j]
+    std::vector<std::array<idx_t, 2>> rows;
+    std::vector<gidx_t> row_offset{0};
+    for (idx_t t = 0; t < nTiles_; ++t) {
+        for (idx_t j = 0; j <= jmax_[t]; ++j) {
+            rows.push_back({t, j});
+            row_offset.push_back(row_offset.back() + imax_[t][j] + 1);
+        }
+    }
+    if (row_offset.back() != size()) {
+        return false;
+    }
+
+    const idx_t nb_rows = static_cast<idx_t>(rows.size());
+    atlas_omp_parallel_for(idx_t r = 0; r < nb_rows; ++r) {
+        const gidx_t row_begin = std::max<gidx_t>(begin, row_offset[r]);
+        const gidx_t row_end   = std::min<gidx_t>(end, row_offset[r + 1]);
+        const idx_t t          = rows[r][0];
+        const idx_t j          = rows[r][1];
+        for (gidx_t n = row_begin; n < row_end; ++n) {
+            compute_point(static_cast<idx_t>(n - row_offset[r]), j, t, crd + 2 * (n - begin));
+        }
+    }
+    return true;
+}
+
+void CubedSphere::compute_xy(idx_t begin, idx_t end, double xy[]) const {
+    if (not compute_range(begin, end, xy,
+                          [this](idx_t i, idx_t j, idx_t t, double crd[]) { this->xy(i, j, t, crd); })) {
+        Grid::compute_xy(begin, end, xy);
+    }
+}
+
+void CubedSphere::compute_lonlat(idx_t begin, idx_t end, double lonlat[]) const {
+    if (not compute_range(begin, end, lonlat,
+                          [this](idx_t i, idx_t j, idx_t t, double crd[]) { this->lonlat(i, j, t, crd); })) {
+        Grid::compute_lonlat(begin, end, lonlat);
+    }
+}
+
 // Print the name of the Grid
 void CubedSphere::print(std::ostream& os) const {
     os << "CubedSphere(Name:" << name() << ")";
@@ -406,6 +406,11 @@ public:
     virtual std::unique_ptr<Grid::IteratorLonLat> lonlat_end() const override {
         return std::make_unique<IteratorLonLat>(*this, false);
     }
+    /// @brief Compute xy coordinates tile row by tile row, without iterators
+    virtual void compute_xy(idx_t begin, idx_t end, double xy[]) const override;
+
+    virtual void compute_lonlat(idx_t begin, idx_t end, double lonlat[]) const override;
+
     virtual std::unique_ptr<IteratorTIJ> tij_begin() const {
         return std::make_unique<IteratorTIJ>(*this);
     }
@@ -431,6 +436,10 @@ protected:
     Domain computeDomain() const;
 
 private:
+    /// Returns false, without computing anything, if the rows are not laid out as assumed
+    template <typename ComputePoint>
+    bool compute_range(idx_t begin, idx_t end, double crd[], const ComputePoint&) const;
+
     void xy2xyt(const double xy[], double xyt[]) const;  // note: unused!
 
     void xyt2xy(const double xyt[], double xy[]) const;
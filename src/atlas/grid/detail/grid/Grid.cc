@@ -10,6 +10,9 @@
 
 #include "Grid.h"
 
+#include <algorithm>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 #include "eckit/utils/MD5.h"
@@ -21,6 +24,7 @@
 #include "atlas/grid/detail/grid/Structured.h"
 #include "atlas/grid/detail/grid/Unstructured.h"
 #include "atlas/mesh/Mesh.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 
@@ -109,6 +113,48 @@ Grid::Grid() {
     checkSizeOfPoint();
 }
 
+namespace {
+// Fill crd with the points of range [begin, end), given a function returning an iterator at the first grid point.
+// The range is split in chunks so that each OpenMP thread advances its own iterator.
+template <typename BeginIterator>
+void compute_with_iterators(const BeginIterator& begin_iterator, idx_t begin, idx_t end, double crd[]) {
+    constexpr idx_t chunk_size = 4096;
+    const idx_t nb_chunks      = (end - begin + chunk_size - 1) / chunk_size;
+    atlas_omp_parallel_for(idx_t chunk = 0; chunk < nb_chunks; ++chunk) {
+        const idx_t chunk_begin = begin + chunk * chunk_size;
+        const idx_t chunk_end   = std::min(chunk_begin + chunk_size, end);
+        auto it                 = begin_iterator();
+        if (chunk_begin > 0) {
+            *it += chunk_begin;
+        }
+        typename std::decay<decltype(**it)>::type point;
+        for (idx_t n = chunk_begin; n < chunk_end; ++n) {
+            it->next(point);
+            crd[2 * (n - begin) + 0] = point[0];
+            crd[2 * (n - begin) + 1] = point[1];
+        }
+    }
+}
+}  // namespace
+
+void Grid::check_range(idx_t begin, idx_t end) const {
+    if (begin < 0 || begin > end || end > size()) {
+        throw_Exception("Grid: range [" + std::to_string(begin) + "," + std::to_string(end) +
+                            ") is not within grid of size " + std::to_string(size()),
+                        Here());
+    }
+}
+
+void Grid::compute_xy(idx_t begin, idx_t end, double xy[]) const {
+    check_range(begin, end);
+    compute_with_iterators([this] { return xy_begin(); }, begin, end, xy);
+}
+
+void Grid::compute_lonlat(idx_t begin, idx_t end, double lonlat[]) const {
+    check_range(begin, end);
+    compute_with_iterators([this] { return lonlat_begin(); }, begin, end, lonlat);
+}
+
 Grid::~Grid() {
     while (grid_observers_.size()) {
         GridObserver* o = grid_observers_.back();
@@ -124,6 +124,15 @@ public:  // methods
     virtual std::unique_ptr<IteratorLonLat> lonlat_begin() const = 0;
     virtual std::unique_ptr<IteratorLonLat> lonlat_end() const   = 0;
 
+    /// @brief Compute xy coordinates of the grid points with global index in range [begin, end)
+    /// Point n is written to xy[2*(n-begin)] and xy[2*(n-begin)+1]. Derived classes compute the
+    /// coordinates directly instead of going through the iterators.
+    virtual void compute_xy(idx_t begin, idx_t end, double xy[]) const;
+
+    /// @brief Compute lonlat coordinates of the grid points with global index in range [begin, end)
+    /// Point n is written to lonlat[2*(n-begin)] and lonlat[2*(n-begin)+1].
+    virtual void compute_lonlat(idx_t begin, idx_t end, double lonlat[]) const;
+
     void attachObserver(GridObserver&) const;
     void detachObserver(GridObserver&) const;
 
@@ -134,6 +143,9 @@ protected:  // methods
     /// Fill provided me
     virtual void print(std::ostream&) const = 0;
 
+    /// Assert that [begin, end) is a valid range of global indices
+    void check_range(idx_t begin, idx_t end) const;
+
 private:  // methods
     friend std::ostream& operator<<(std::ostream& s, const Grid& p) {
         p.print(s);
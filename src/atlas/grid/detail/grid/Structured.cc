@@ -25,6 +25,7 @@
 #include "atlas/grid/detail/spacing/CustomSpacing.h"
 #include "atlas/grid/detail/spacing/LinearSpacing.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
@@ -641,6 +642,37 @@ void Structured::computeTruePeriodicity() {
     periodic_x_ = points_equal(Pxmin, Pxmax);
 }
 
+void Structured::compute_xy(idx_t begin, idx_t end, double xy[]) const {
+    check_range(begin, end);
+    if (begin == end) {
+        return;
+    }
+    idx_t i, j_begin, j_last;
+    index2ij(begin, i, j_begin);
+    index2ij(end - 1, i, j_last);
+    atlas_omp_parallel_for(idx_t j = j_begin; j <= j_last; ++j) {
+        const gidx_t row_begin = std::max<gidx_t>(begin, jglooff_[j]);
+        const gidx_t row_end   = std::min<gidx_t>(end, jglooff_[j] + nx_[j]);
+        const idx_t i_begin    = static_cast<idx_t>(row_begin - jglooff_[j]);
+        const idx_t i_end      = static_cast<idx_t>(row_end - jglooff_[j]);
+        const double xmin      = xmin_[j];
+        const double dx        = dx_[j];
+        const double y         = y_[j];
+        double* crd            = xy + 2 * (row_begin - begin);
+        for (idx_t i = i_begin; i < i_end; ++i) {
+            crd[2 * (i - i_begin) + 0] = xmin + static_cast<double>(i) * dx;
+            crd[2 * (i - i_begin) + 1] = y;
+        }
+    }
+}
+
+void Structured::compute_lonlat(idx_t begin, idx_t end, double lonlat[]) const {
+    compute_xy(begin, end, lonlat);
+    if (projection_.type() != "lonlat") {
+        atlas_omp_parallel_for(idx_t n = 0; n < end - begin; ++n) { projection_.xy2lonlat(lonlat + 2 * n); }
+    }
+}
+
 void Structured::print(std::ostream& os) const {
     os << "Structured(Name:" << name() << ")";
 }
@@ -349,6 +349,11 @@ public:
         return std::make_unique<IteratorLonLat>(*this, false);
     }
 
+    /// @brief Compute xy coordinates row by row, without iterators
+    virtual void compute_xy(idx_t begin, idx_t end, double xy[]) const override;
+
+    virtual void compute_lonlat(idx_t begin, idx_t end, double lonlat[]) const override;
+
     gidx_t index(idx_t i, idx_t j) const { return jglooff_[j] + i; }
 
     void index2ij(gidx_t gidx, idx_t& i, idx_t& j) const {
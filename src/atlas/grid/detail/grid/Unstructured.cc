@@ -23,6 +23,7 @@
 #include "atlas/grid/detail/grid/GridBuilder.h"
 #include "atlas/grid/detail/grid/GridFactory.h"
 #include "atlas/option.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/util/CoordinateEnums.h"
@@ -229,6 +230,22 @@ Grid::Config Unstructured::partitioner() const {
     return Config("type", "equal_regions");
 }
 
+void Unstructured::compute_xy(idx_t begin, idx_t end, double xy[]) const {
+    check_range(begin, end);
+    const PointXY* points = points_->data();
+    atlas_omp_parallel_for(idx_t n = begin; n < end; ++n) {
+        xy[2 * (n - begin) + 0] = points[n][0];
+        xy[2 * (n - begin) + 1] = points[n][1];
+    }
+}
+
+void Unstructured::compute_lonlat(idx_t begin, idx_t end, double lonlat[]) const {
+    compute_xy(begin, end, lonlat);
+    if (projection_.type() != "lonlat") {
+        atlas_omp_parallel_for(idx_t n = 0; n < end - begin; ++n) { projection_.xy2lonlat(lonlat + 2 * n); }
+    }
+}
+
 void Unstructured::print(std::ostream& os) const {
     os << "Unstructured(Npts:" << size() << ")";
 }
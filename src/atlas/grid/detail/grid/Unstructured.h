@@ -193,6 +193,11 @@ public:  // methods
         return std::make_unique<IteratorLonLat>(*this, false);
     }
 
+    /// @brief Copy xy coordinates from the stored points, without iterators
+    virtual void compute_xy(idx_t begin, idx_t end, double xy[]) const override;
+
+    virtual void compute_lonlat(idx_t begin, idx_t end, double lonlat[]) const override;
+
     Config meshgenerator() const override;
     Config partitioner() const override;
 
@@ -10,6 +10,9 @@
 
 #include "atlas/grid/detail/partitioner/EqualAreaPartitioner.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "atlas/grid.h"
 #include "atlas/grid/Iterator.h"
 #include "atlas/util/Constants.h"
@@ -55,11 +58,17 @@ void EqualAreaPartitioner::partition(const Grid& grid, int part[]) const {
         }
     }
     else {
-        size_t j{0};
-        for (PointLonLat p : grid.lonlat()) {
-            p.lon() *= util::Constants::degreesToRadians();
-            p.lat() *= util::Constants::degreesToRadians();
-            part[j++] = partitioner_.partition(p.lon(), p.lat());
+        // Coordinates are computed in bulk, a chunk at a time to bound memory use
+        constexpr idx_t chunk_size = 65536;
+        std::vector<double> lonlat(2 * std::min(chunk_size, grid.size()));
+        for (idx_t begin = 0; begin < grid.size(); begin += chunk_size) {
+            const idx_t end = std::min(begin + chunk_size, grid.size());
+            grid.compute_lonlat(begin, end, lonlat.data());
+            for (idx_t n = begin; n < end; ++n) {
+                const double lon = lonlat[2 * (n - begin) + 0] * util::Constants::degreesToRadians();
+                const double lat = lonlat[2 * (n - begin) + 1] * util::Constants::degreesToRadians();
+                part[n]          = partitioner_.partition(lon, lat);
+            }
         }
     }
 
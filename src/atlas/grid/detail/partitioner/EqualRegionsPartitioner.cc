@@ -15,12 +15,14 @@
 #include <ctime>
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <vector>
 
 #include "atlas/grid/Iterator.h"
 #include "atlas/grid/StructuredGrid.h"
 #include "atlas/parallel/mpi/Buffer.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/parallel/omp/sort.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
@@ -40,31 +42,6 @@ namespace {
 static bool valid_mpi_size(size_t size) {
     return size < size_t(std::numeric_limits<int>::max());
 }
-
-
-template <class Iterator, class Sentinel = Iterator>
-struct range_t {
-    Iterator b;
-    Sentinel e;
-    Iterator begin() const { return b; }
-    Sentinel end() const { return e; }
-    // unused:
-    // bool empty() const { return begin() == end(); }
-};
-
-template <class Iterator, class Sentinel>
-range_t<Iterator, Sentinel> range(Iterator b, Sentinel e) {
-    return {b, e};
-}
-
-template <typename Container, typename Int>
-range_t<typename Container::const_iterator, typename Container::const_iterator> subrange(
-    const Container& c, std::initializer_list<Int>&& _range) {
-    const Int rbegin = _range.begin()[0];
-    const Int rend   = _range.begin()[1];
-    return range(c.begin() + rbegin, c.begin() + rend);
-}
-
 }  // namespace
 
 double gamma(const double& x) {
@@ -731,61 +708,19 @@ void EqualRegionsPartitioner::partition(const Grid& grid, int part[]) const {
                     atlas::vector<NodeInt> w_nodes(w_size);
                     int* w_nodes_buffer = reinterpret_cast<int*>(w_nodes.data());
 
-                    if (coordinates_ == Coordinates::XY) {
-                        ATLAS_TRACE_SCOPE("create one bit - Coordinates::XY") {
-                            if (true)  // optimized experimental when true (still need to
-                            // benchmark)
-                            {
-                                int i = w_begin;
-                                int j(0);
-                                for (const auto& point : subrange(grid.xy(), {w_begin, w_end})) {
-                                    w_nodes[j].x = microdeg(point[0]);
-                                    w_nodes[j].y = microdeg(point[1]);
-                                    w_nodes[j].n = i++;
-                                    ++j;
-                                }
+                    if (coordinates_ == Coordinates::XY || coordinates_ == Coordinates::LONLAT) {
+                        ATLAS_TRACE_SCOPE("create one bit") {
+                            std::vector<double> crd(2 * w_size);
+                            if (coordinates_ == Coordinates::XY) {
+                                grid.compute_xy(w_begin, w_end, crd.data());
                             }
                             else {
-                                idx_t i(0);
-                                idx_t j(0);
-                                for (const auto& point : grid.xy()) {
-                                    if (i >= w_begin && i < w_end) {
-                                        w_nodes[j].x = microdeg(point[0]);
-                                        w_nodes[j].y = microdeg(point[1]);
-                                        w_nodes[j].n = i;
-                                        ++j;
-                                    }
-                                    ++i;
-                                }
+                                grid.compute_lonlat(w_begin, w_end, crd.data());
                             }
-                        }
-                    }
-                    else if (coordinates_ == Coordinates::LONLAT) {
-                        ATLAS_TRACE_SCOPE("create one bit - Coordinates::LONLAT") {
-                            if (true)  // optimized experimental when true (still need to
-                            // benchmark)
-                            {
-                                int i = w_begin;
-                                int j(0);
-                                for (const auto& point : subrange(grid.lonlat(), {w_begin, w_end})) {
-                                    w_nodes[j].x = microdeg(point[0]);
-                                    w_nodes[j].y = microdeg(point[1]);
-                                    w_nodes[j].n = i++;
-                                    ++j;
-                                }
-                            }
-                            else {
-                                idx_t i(0);
-                                idx_t j(0);
-                                for (const auto& point : grid.xy()) {
-                                    if (i >= w_begin && i < w_end) {
-                                        w_nodes[j].x = microdeg(point[0]);
-                                        w_nodes[j].y = microdeg(point[1]);
-                                        w_nodes[j].n = i;
-                                        ++j;
-                                    }
-                                    ++i;
-                                }
+                            atlas_omp_parallel_for(idx_t j = 0; j < w_size; ++j) {
+                                w_nodes[j].x = microdeg(crd[2 * j + 0]);
+                                w_nodes[j].y = microdeg(crd[2 * j + 1]);
+                                w_nodes[j].n = w_begin + j;
                             }
                         }
                     }
@@ -978,6 +913,147 @@ void EqualRegionsPartitioner::partition(const Grid& grid, int part[]) const {
     }      // else
 }
 
+bool EqualRegionsPartitioner::partition(const Grid& grid, std::vector<gidx_t>& run_begin,
+                                        std::vector<int>& run_part) const {
+    run_begin.clear();
+    run_part.clear();
+    if (N_ == 1) {
+        run_begin.emplace_back(0);
+        run_part.emplace_back(0);
+        return true;
+    }
+
+    StructuredGrid structured_grid(grid);
+    if (not structured_grid || coordinates_ != Coordinates::XY || grid.projection().units() != "degrees") {
+        return false;
+    }
+
+    // Same integer coordinates as used for sorting in partition(const Grid&, int[])
+    const idx_t ny = structured_grid.ny();
+    std::vector<int> y(ny);
+    std::vector<gidx_t> row_begin(ny + 1, 0);
+    for (idx_t j = 0; j < ny; ++j) {
+        y[j]             = microdeg(structured_grid.y(j));
+        row_begin[j + 1] = row_begin[j] + structured_grid.nx(j);
+        if (j > 0 && y[j] >= y[j - 1]) {
+            // Rows are not sorted from north to south
+            return false;
+        }
+    }
+    auto x = [&](idx_t i, idx_t j) { return microdeg(structured_grid.x(i, j)); };
+
+    ATLAS_TRACE("EqualRegionsPartitioner::partition");
+
+    // Same number of points per partition as partition(const Grid&, int[])
+    const gidx_t nb_nodes        = grid.size();
+    const gidx_t chunk_size      = nb_nodes / N_;
+    const gidx_t chunk_remainder = nb_nodes - chunk_size * N_;
+    std::vector<gidx_t> displs(N_ + 1, 0);
+    for (int p = 0; p < N_; ++p) {
+        displs[p + 1] = displs[p] + chunk_size + (p < chunk_remainder ? 1 : 0);
+    }
+
+    // Part of a row within a band
+    struct Row {
+        idx_t j;
+        idx_t i_begin;
+        idx_t i_end;
+    };
+
+    // First index in row with x >= X
+    auto lower_bound = [&](const Row& row, long X) {
+        idx_t lo = row.i_begin;
+        idx_t hi = row.i_end;
+        while (lo < hi) {
+            idx_t mid = lo + (hi - lo) / 2;
+            if (x(mid, row.j) < X) {
+                lo = mid + 1;
+            }
+            else {
+                hi = mid;
+            }
+        }
+        return lo;
+    };
+
+    int w0 = 0;
+    for (int band = 0; band < nb_bands(); ++band) {
+        const int nb_reg     = nb_regions(band);
+        const gidx_t b_begin = displs[w0];
+        const gidx_t b_end   = displs[w0 + nb_reg];
+
+        // Points of a band are consecutive in the grid, as rows are sorted from north to south
+        std::vector<Row> rows;
+        long xmin = std::numeric_limits<long>::max();
+        long xmax = std::numeric_limits<long>::lowest();
+        idx_t j   = std::upper_bound(row_begin.begin(), row_begin.end(), b_begin) - row_begin.begin() - 1;
+        for (; j < ny && row_begin[j] < b_end; ++j) {
+            idx_t i_begin = std::max(b_begin, row_begin[j]) - row_begin[j];
+            idx_t i_end   = std::min(b_end, row_begin[j + 1]) - row_begin[j];
+            if (i_begin < i_end) {
+                rows.emplace_back(Row{j, i_begin, i_end});
+                xmin = std::min<long>(xmin, x(i_begin, j));
+                xmax = std::max<long>(xmax, x(i_end - 1, j));
+            }
+        }
+        const size_t nb_rows = rows.size();
+
+        // split[k][r] is the first index in row r that is not within the first k regions of the band,
+        // following the west-to-east, north-to-south order of compare_WE_NS
+        std::vector<std::vector<idx_t>> split(nb_reg + 1, std::vector<idx_t>(nb_rows));
+        for (size_t r = 0; r < nb_rows; ++r) {
+            split[0][r]      = rows[r].i_begin;
+            split[nb_reg][r] = rows[r].i_end;
+        }
+        for (int k = 1; k < nb_reg; ++k) {
+            const gidx_t c = displs[w0 + k] - b_begin;
+            auto count_lt  = [&](long X) {
+                gidx_t count = 0;
+                for (const auto& row : rows) {
+                    count += lower_bound(row, X) - row.i_begin;
+                }
+                return count;
+            };
+            // Smallest X such that at least c points have x <= X
+            long lo = xmin;
+            long hi = xmax;
+            while (lo < hi) {
+                long mid = lo + (hi - lo) / 2;
+                if (count_lt(mid + 1) >= c) {
+                    hi = mid;
+                }
+                else {
+                    lo = mid + 1;
+                }
+            }
+            // All points west of X, completed with points at X from north to south
+            gidx_t remaining = c - count_lt(lo);
+            for (size_t r = 0; r < nb_rows; ++r) {
+                idx_t i_lo = lower_bound(rows[r], lo);
+                idx_t i_hi = lower_bound(rows[r], lo + 1);
+                idx_t take = static_cast<idx_t>(std::min<gidx_t>(i_hi - i_lo, remaining));
+                remaining -= take;
+                split[k][r] = i_lo + take;
+            }
+        }
+
+        for (size_t r = 0; r < nb_rows; ++r) {
+            for (int k = 0; k < nb_reg; ++k) {
+                if (split[k + 1][r] > split[k][r]) {
+                    gidx_t begin = row_begin[rows[r].j] + split[k][r];
+                    if (not run_part.empty() && run_part.back() == w0 + k) {
+                        continue;
+                    }
+                    run_begin.emplace_back(begin);
+                    run_part.emplace_back(w0 + k);
+                }
+            }
+        }
+        w0 += nb_reg;
+    }
+    return true;
+}
+
 }  // namespace partitioner
 }  // namespace detail
 }  // namespace grid
@@ -91,6 +91,11 @@ public:
     using Partitioner::partition;
     virtual void partition(const Grid&, int part[]) const;
 
+    /// For a StructuredGrid partitioned in XY coordinates, the regions of every band are computed
+    /// row by row with a bisection over the sorted longitudes, which gives the same partitions as
+    /// partition(const Grid&, int[]) without sorting or storing all grid points.
+    virtual bool partition(const Grid&, std::vector<gidx_t>& run_begin, std::vector<int>& run_part) const;
+
     virtual std::string type() const { return "equal_regions"; }
 
 public:
@@ -19,8 +19,10 @@
 #include "eckit/thread/Mutex.h"
 
 #include "atlas/grid/Distribution.h"
+#include "atlas/grid/Grid.h"
 #include "atlas/grid/Partitioner.h"
 #include "atlas/grid/detail/distribution/DistributionArray.h"
+#include "atlas/grid/detail/distribution/DistributionRunLength.h"
 #include "atlas/grid/detail/partitioner/BandsPartitioner.h"
 #include "atlas/grid/detail/partitioner/CheckerboardPartitioner.h"
 #include "atlas/grid/detail/partitioner/CubedSpherePartitioner.h"
@@ -107,7 +109,22 @@ idx_t Partitioner::nb_partitions() const {
 }
 
 Distribution Partitioner::partition(const Grid& grid) const {
-    return new distribution::DistributionArray{grid, atlas::grid::Partitioner(this)};
+    std::vector<gidx_t> run_begin;
+    std::vector<int> run_part;
+    if (partition(grid, run_begin, run_part)) {
+        return new distribution::DistributionRunLength{atlas::grid::Partitioner(this), grid.size(),
+                                                       std::move(run_begin), std::move(run_part)};
+    }
+
+    atlas::vector<int> part(grid.size());
+    partition(grid, part.data());
+    // Most partitioners assign long contiguous ranges of global indices to each partition.
+    // Prefer the compact run-length representation then, so that the memory retained by
+    // the distribution does not scale with the global grid size.
+    if (distribution::DistributionRunLength::compresses(part.size(), part.data())) {
+        return new distribution::DistributionRunLength{atlas::grid::Partitioner(this), part.size(), part.data()};
+    }
+    return new distribution::DistributionArray{atlas::grid::Partitioner(this), std::move(part)};
 }
 
 std::string Partitioner::mpi_comm() const { return mpi_comm_; }
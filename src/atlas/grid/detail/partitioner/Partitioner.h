@@ -11,6 +11,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "atlas/library/config.h"
 #include "atlas/util/Config.h"
@@ -45,6 +46,14 @@ public:
 
     virtual Distribution partition(const Grid& grid) const;
 
+    /// @brief Partition grid as runs of consecutive global indices, without a global partition array
+    ///
+    /// Returns false if this partitioner cannot produce runs directly for given grid, in which case
+    /// partition(const Grid&, int[]) is used instead.
+    virtual bool partition(const Grid&, std::vector<gidx_t>& /*run_begin*/, std::vector<int>& /*run_part*/) const {
+        return false;
+    }
+
     idx_t nb_partitions() const;
 
     virtual std::string type() const = 0;
@@ -9,7 +9,17 @@
  */
 
 #include "atlas/interpolation/Cache.h"
+
+#include <exception>
+#include <string>
+
+#include "eckit/container/KDTree.h"
+
+#include "atlas/grid/Grid.h"
 #include "atlas/interpolation/Interpolation.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+
 namespace atlas {
 namespace interpolation {
 
@@ -126,6 +136,58 @@ IndexKDTreeCache::IndexKDTreeCache(const IndexKDTree& tree): Cache(std::make_sha
 
 IndexKDTreeCache::IndexKDTreeCache(const Interpolation& interpolation): IndexKDTreeCache(Cache(interpolation)) {}
 
+namespace {
+using MappedIndexKDTree = eckit::KDTreeMapped<IndexKDTreeCacheEntry::IndexKDTree::Implementation::KDTreeTraits>;
+
+// Version of the layout of cached kd-tree files, part of their name so that files written by builds with a
+// different layout are not mapped. It must be increased whenever the payload, point type or tree layout changes.
+constexpr int mapped_tree_format = 1;
+
+// The cached tree of the grid, or an empty cache if an existing file cannot be mapped or does not match the grid
+Cache mapped_tree(const Grid& grid, const eckit::PathName& directory) {
+    using IndexKDTree = IndexKDTreeCacheEntry::IndexKDTree;
+    ATLAS_TRACE("IndexKDTreeCache: mapped tree");
+
+    const eckit::PathName path =
+        directory / ("atlas-kdtree-v" + std::to_string(mapped_tree_format) + "-" + grid.uid() + ".kdtree");
+    if (not path.exists()) {
+        Log::debug() << "Building kd-tree for grid " << grid.name() << " in " << path << std::endl;
+        directory.mkdir();
+
+        // Build in a unique file which is renamed when complete, so that other processes never map a partial tree
+        const eckit::PathName tmp = eckit::PathName::unique(path);
+        {
+            IndexKDTree tree(std::make_shared<MappedIndexKDTree>(tmp, static_cast<size_t>(grid.size()), 0),
+                             util::Geometry());
+            tree.reserve(grid.size());
+            idx_t n{0};
+            for (const auto& p : grid.lonlat()) {
+                tree.insert(p, n++);
+            }
+            tree.build();
+        }
+        eckit::PathName::rename(tmp, path);
+    }
+
+    try {
+        IndexKDTree tree(std::make_shared<MappedIndexKDTree>(path, 0, 0), util::Geometry());
+        if (tree.size() == static_cast<size_t>(grid.size())) {
+            return IndexKDTreeCache(tree);
+        }
+        Log::warning() << "IndexKDTreeCache: " << path << " holds " << tree.size() << " points instead of "
+                       << grid.size() << " for grid " << grid.name() << "; it is not used" << std::endl;
+    }
+    catch (const std::exception& e) {
+        Log::warning() << "IndexKDTreeCache: " << path << " cannot be mapped and is not used: " << e.what()
+                       << std::endl;
+    }
+    return Cache();
+}
+}  // namespace
+
+IndexKDTreeCache::IndexKDTreeCache(const Grid& grid, const eckit::PathName& directory):
+    IndexKDTreeCache(mapped_tree(grid, directory)) {}
+
 IndexKDTreeCache::operator bool() const {
     return tree_;  //&& !tree().empty();
 }
@@ -26,6 +26,7 @@
 // Forward declarations
 
 namespace atlas {
+class Grid;
 class Interpolation;
 }  // namespace atlas
 
@@ -149,6 +150,14 @@ public:
     IndexKDTreeCache(const IndexKDTreeCache& c) : IndexKDTreeCache(Cache(c)) {}
     IndexKDTreeCache(const IndexKDTree&);
     IndexKDTreeCache(const Interpolation&);
+
+    /// @brief Cache the kd-tree of the points of a grid in a memory-mapped file in given directory
+    ///
+    /// The file is named after Grid::uid() and the version of the file layout. If it does not exist yet, the tree
+    /// is built (with payloads the grid point indices) and written to it, otherwise the existing file is mapped
+    /// read-only. Processes on the same node then share the pages of the tree instead of each building their own.
+    /// If the existing file cannot be mapped or does not hold the points of the grid, the cache is empty.
+    IndexKDTreeCache(const Grid&, const eckit::PathName& directory);
     operator bool() const;
     const IndexKDTree& tree() const;
     size_t footprint() const;
@@ -52,5 +52,11 @@ bool NonLinear::execute(NonLinear::Matrix& W, const Field& f) const {
 }
 
 
+bool NonLinear::interpolate(const NonLinear::Matrix& W, const Field& src, Field& tgt) const {
+    ATLAS_ASSERT_MSG(operator bool(), "NonLinear: ObjectHandle not setup");
+    return get()->interpolate(W, src, tgt);
+}
+
+
 }  // namespace interpolation
 }  // namespace atlas
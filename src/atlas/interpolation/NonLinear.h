@@ -67,6 +67,15 @@ struct NonLinear : DOXYGEN_HIDE(public util::ObjectHandle<nonlinear::NonLinear>)
      * @return if W was modified
      */
     bool execute(Matrix& W, const Field& f) const;
+
+    /**
+     * @brief Interpolate field with non-linear corrections applied on the fly, without modifying the matrix
+     * @param [in] W interpolation matrix
+     * @param [in] src source field
+     * @param [inout] tgt target field
+     * @return if the interpolation was done (otherwise use execute on a copy of W)
+     */
+    bool interpolate(const Matrix& W, const Field& src, Field& tgt) const;
 };
 
 
@@ -20,6 +20,7 @@
 #include "atlas/functionspace/NodeColumns.h"
 #include "atlas/linalg/sparse.h"
 #include "atlas/mesh/Nodes.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
@@ -105,6 +106,9 @@ void Method::interpolate_field_rank1(const Field& src, Field& tgt, const Matrix&
     auto tgt_v   = array::make_view<Value, 1>(tgt);
 
     if (nonLinear_(src)) {
+        if (nonLinear_.interpolate(W, src, tgt)) {
+            return;
+        }
         Matrix W_nl(W);  // copy (a big penalty -- copy-on-write would definitely be better)
         nonLinear_->execute(W_nl, src);
         sparse_matrix_multiply(W_nl, src_v, tgt_v, backend);
@@ -122,6 +126,11 @@ void Method::interpolate_field_rank2(const Field& src, Field& tgt, const Matrix&
     auto tgt_v = array::make_view<Value, 2>(tgt);
 
     if (nonLinear_(src)) {
+        // Corrections are computed per row and level on the fly, without modifying the matrix
+        if (nonLinear_.interpolate(W, src, tgt)) {
+            return;
+        }
+
         // We cannot apply the same matrix to full columns as e.g. missing values could be present in only certain parts.
 
         // Allocate temporary rank-1 fields corresponding to one horizontal level
@@ -167,66 +176,85 @@ void Method::interpolate_field_rank3(const Field& src, Field& tgt, const Matrix&
 }
 
 template <typename Value>
-void Method::adjoint_interpolate_field_rank1(Field& src, const Field& tgt, const Matrix& W) const {
-    array::ArrayT<Value> tmp(src.shape());
-
-    auto tmp_v = array::make_view<Value, 1>(tmp);
-    auto src_v = array::make_view<Value, 1>(src);
-    auto tgt_v = array::make_view<Value, 1>(tgt);
+void Method::interpolate_fields(const std::vector<Field>& src, std::vector<Field>& tgt, const Matrix& W) const {
+    // Each field contributes its levels as extra columns of one sparse matrix - dense matrix product,
+    // so that the sparse matrix is traversed only once for all fields.
+    struct Columns {
+        const Value* src;
+        Value* tgt;
+        idx_t src_stride;
+        idx_t tgt_stride;
+        idx_t src_level_stride;
+        idx_t tgt_level_stride;
+        idx_t levels;
+    };
+    std::vector<Columns> columns;
+    columns.reserve(src.size());
+    for (size_t f = 0; f < src.size(); ++f) {
+        if (src[f].rank() == 1) {
+            auto src_v = array::make_view<Value, 1>(src[f]);
+            auto tgt_v = array::make_view<Value, 1>(tgt[f]);
+            columns.emplace_back(Columns{src_v.data(), tgt_v.data(), src_v.stride(0), tgt_v.stride(0), 0, 0, 1});
+        }
+        else {
+            auto src_v = array::make_view<Value, 2>(src[f]);
+            auto tgt_v = array::make_view<Value, 2>(tgt[f]);
+            columns.emplace_back(Columns{src_v.data(), tgt_v.data(), src_v.stride(0), tgt_v.stride(0), src_v.stride(1),
+                                         tgt_v.stride(1), src_v.shape(1)});
+        }
+    }
 
-    tmp_v.assign(0.);
+    const auto outer      = W.outer();
+    const auto index      = W.inner();
+    const auto weight     = W.data();
+    const idx_t rows      = static_cast<idx_t>(W.rows());
+    const idx_t nb_fields = static_cast<idx_t>(columns.size());
 
-    if (std::is_same<Value, float>::value) {
-        sparse_matrix_multiply(W, tgt_v, tmp_v, sparse::backend::openmp());
-    }
-    else {
-        sparse_matrix_multiply(W, tgt_v, tmp_v, sparse::Backend{linalg_backend_});
+    atlas_omp_parallel_for(idx_t r = 0; r < rows; ++r) {
+        for (idx_t f = 0; f < nb_fields; ++f) {
+            const auto& col = columns[f];
+            Value* tgt_r    = col.tgt + r * col.tgt_stride;
+            for (idx_t k = 0; k < col.levels; ++k) {
+                tgt_r[k * col.tgt_level_stride] = 0.;
+            }
+        }
+        for (auto c = outer[r]; c < outer[r + 1]; ++c) {
+            const idx_t n = index[c];
+            const Value w = static_cast<Value>(weight[c]);
+            for (idx_t f = 0; f < nb_fields; ++f) {
+                const auto& col    = columns[f];
+                const Value* src_n = col.src + n * col.src_stride;
+                Value* tgt_r       = col.tgt + r * col.tgt_stride;
+                for (idx_t k = 0; k < col.levels; ++k) {
+                    tgt_r[k * col.tgt_level_stride] += w * src_n[k * col.src_level_stride];
+                }
+            }
+        }
     }
+}
 
+template <typename Value>
+void Method::adjoint_interpolate_field_rank1(Field& src, const Field& tgt, const Matrix& W) const {
+    auto src_v = array::make_view<Value, 1>(src);
+    auto tgt_v = array::make_view<Value, 1>(tgt);
 
-    for (idx_t t = 0; t < tmp.shape(0); ++t) {
-        src_v(t) += tmp_v(t);
-    }
+    sparse_matrix_multiply_add_transpose(W, tgt_v, src_v);
 }
 
 template <typename Value>
 void Method::adjoint_interpolate_field_rank2(Field& src, const Field& tgt, const Matrix& W) const {
-    array::ArrayT<Value> tmp(src.shape());
-
-    auto tmp_v = array::make_view<Value, 2>(tmp);
     auto src_v = array::make_view<Value, 2>(src);
     auto tgt_v = array::make_view<Value, 2>(tgt);
 
-    tmp_v.assign(0.);
-
-    sparse_matrix_multiply(W, tgt_v, tmp_v, sparse::backend::openmp());
-
-    for (idx_t t = 0; t < tmp.shape(0); ++t) {
-        for (idx_t k = 0; k < tmp.shape(1); ++k) {
-            src_v(t, k) += tmp_v(t, k);
-        }
-    }
+    sparse_matrix_multiply_add_transpose(W, tgt_v, src_v);
 }
 
 template <typename Value>
 void Method::adjoint_interpolate_field_rank3(Field& src, const Field& tgt, const Matrix& W) const {
-    array::ArrayT<Value> tmp(src.shape());
-
-    auto tmp_v = array::make_view<Value, 3>(tmp);
     auto src_v = array::make_view<Value, 3>(src);
     auto tgt_v = array::make_view<Value, 3>(tgt);
 
-    tmp_v.assign(0.);
-
-    sparse_matrix_multiply(W, tgt_v, tmp_v, sparse::backend::openmp());
-
-    for (idx_t t = 0; t < tmp.shape(0); ++t) {
-        for (idx_t j = 0; j < tmp.shape(1); ++j) {
-            for (idx_t k = 0; k < tmp.shape(2); ++k) {
-                src_v(t, j, k) += tmp_v(t, j, k);
-            }
-        }
-    }
+    sparse_matrix_multiply_add_transpose(W, tgt_v, src_v);
 }
 
 void Method::check_compatibility(const Field& src, const Field& tgt, const Matrix& W) const {
@@ -270,7 +298,7 @@ void Method::adjoint_interpolate_field(Field& src, const Field& tgt, const Matri
     if (tgt.shape(0) == 0) {
         return;
     }
-    check_compatibility(tgt, src, W);
+    check_compatibility(src, tgt, W);
 
     if (src.rank() == 1) {
         adjoint_interpolate_field_rank1<Value>(src, tgt, W);
@@ -300,15 +328,6 @@ Method::Method(const Method::Config& config) {
 void Method::setup(const FunctionSpace& source, const FunctionSpace& target) {
     ATLAS_TRACE("atlas::interpolation::method::Method::setup(FunctionSpace, FunctionSpace)");
     this->do_setup(source, target);
-
-    if (adjoint_ && target.size() > 0) {
-        Matrix tmp(*matrix_);
-
-        // if interpolation is matrix free then matrix->nonZeros() will be zero.
-        if (tmp.nonZeros() > 0) {
-            matrix_transpose_ = tmp.transpose();
-        }
-    }
 }
 
 void Method::setup(const Grid& source, const Grid& target) {
@@ -373,7 +392,57 @@ void Method::do_execute(const FieldSet& fieldsSource, FieldSet& fieldsTarget, Me
     const idx_t N = fieldsSource.size();
     ATLAS_ASSERT(N == fieldsTarget.size());
 
-    for (idx_t i = 0; i < fieldsSource.size(); ++i) {
+    // One halo exchange for all fields
+    haloExchange(fieldsSource);
+
+    // Linear interpolation of rank-1 and rank-2 fields of the same datatype is batched,
+    // all other fields are interpolated one by one.
+    // The batched product is computed on the host by the openmp kernel below, so fields are only batched when that is
+    // the configured sparse backend; otherwise each field is multiplied by the configured backend.
+    const bool fused = sparse::Backend{linalg_backend_}.type() == sparse::backend::openmp::type();
+    std::vector<Field> src_double, tgt_double, src_float, tgt_float;
+    std::vector<idx_t> unbatched;
+    for (idx_t i = 0; i < N; ++i) {
+        const Field& src = fieldsSource[i];
+        Field tgt        = fieldsTarget[i];
+        bool batchable   = fused && matrix_ && tgt.shape(0) > 0 && (src.rank() == 1 || src.rank() == 2) &&
+                         not nonLinear_(src);
+        if (batchable && src.datatype().kind() == array::DataType::KIND_REAL64) {
+            src_double.emplace_back(src);
+            tgt_double.emplace_back(tgt);
+        }
+        else if (batchable && src.datatype().kind() == array::DataType::KIND_REAL32) {
+            src_float.emplace_back(src);
+            tgt_float.emplace_back(tgt);
+        }
+        else {
+            unbatched.emplace_back(i);
+        }
+    }
+
+    // A single field gains nothing from batching, and keeps the configured sparse backend
+    auto interpolate_batch = [&](std::vector<Field>& src, std::vector<Field>& tgt, auto value) {
+        using Value = decltype(value);
+        if (src.size() == 1) {
+            Method::do_execute(src[0], tgt[0], metadata);
+            return;
+        }
+        if (src.empty()) {
+            return;
+        }
+        ATLAS_TRACE("atlas::interpolation::method::Method::interpolate_fields()");
+        for (size_t f = 0; f < src.size(); ++f) {
+            check_compatibility(src[f], tgt[f], *matrix_);
+        }
+        interpolate_fields<Value>(src, tgt, *matrix_);
+        for (size_t f = 0; f < src.size(); ++f) {
+            finalise_target(src[f], tgt[f]);
+        }
+    };
+    interpolate_batch(src_double, tgt_double, double{});
+    interpolate_batch(src_float, tgt_float, float{});
+
+    for (idx_t i : unbatched) {
         Method::do_execute(fieldsSource[i], fieldsTarget[i], metadata);
     }
 }
@@ -395,6 +464,10 @@ void Method::do_execute(const Field& src, Field& tgt, Metadata&) const {
         }
     }
 
+    finalise_target(src, tgt);
+}
+
+void Method::finalise_target(const Field& src, Field& tgt) const {
     // carry over missing value metadata
     if (not tgt.metadata().has("missing_value")) {
         field::MissingValue mv_src(src);
@@ -442,11 +515,14 @@ void Method::do_execute_adjoint(Field& src, const Field& tgt, Metadata&) const {
         throw_AssertionFailed("Need to set 'adjoint' to true in config for adjoint interpolation to work");
     }
 
-    if (src.datatype().kind() == array::DataType::KIND_REAL64) {
-        adjoint_interpolate_field<double>(src, tgt, matrix_transpose_);
+    if (not matrix_) {  // (matrix == nullptr) when a partition is empty
+        ATLAS_ASSERT(tgt.shape(0) == 0, "Adjoint interpolation requires an interpolation matrix");
+    }
+    else if (src.datatype().kind() == array::DataType::KIND_REAL64) {
+        adjoint_interpolate_field<double>(src, tgt, *matrix_);
     }
     else if (src.datatype().kind() == array::DataType::KIND_REAL32) {
-        adjoint_interpolate_field<float>(src, tgt, matrix_transpose_);
+        adjoint_interpolate_field<float>(src, tgt, *matrix_);
     }
     else {
         ATLAS_NOTIMPLEMENTED;
@@ -474,8 +550,17 @@ void Method::normalise(Triplets& triplets) {
 }
 
 void Method::haloExchange(const FieldSet& fields) const {
+    if (not allow_halo_exchange_) {
+        return;
+    }
+    FieldSet dirty_fields;
     for (auto& field : fields) {
-        haloExchange(field);
+        if (field.dirty()) {
+            dirty_fields.add(field);
+        }
+    }
+    if (dirty_fields.size()) {
+        source().haloExchange(dirty_fields);
     }
 }
 void Method::haloExchange(const Field& field) const {
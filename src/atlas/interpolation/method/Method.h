@@ -142,6 +142,13 @@ private:
     template <typename Value>
     void interpolate_field_rank3(const Field& src, Field& tgt, const Matrix&) const;
 
+    /// Interpolate linear rank-1 and rank-2 fields in one pass over the matrix, on the host. Only used when the
+    /// configured sparse backend is openmp.
+    template <typename Value>
+    void interpolate_fields(const std::vector<Field>& src, std::vector<Field>& tgt, const Matrix&) const;
+
+    void finalise_target(const Field& src, Field& tgt) const;
+
     template <typename Value>
     void adjoint_interpolate_field(Field& src, const Field& tgt, const Matrix&) const;
 
@@ -160,7 +167,6 @@ private:
     interpolation::MatrixCache matrix_cache_;
     NonLinear nonLinear_;
     std::string linalg_backend_;
-    Matrix matrix_transpose_;
 
 protected:
     bool adjoint_{false};
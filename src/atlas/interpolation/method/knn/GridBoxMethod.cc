@@ -35,6 +35,7 @@ GridBoxMethod::GridBoxMethod(const Method::Config& config): KNearestNeighboursBa
     config.get("matrix_free", matrixFree_ = false);
     config.get("fail_early", failEarly_ = true);
     config.get("gaussian_weighted_latitudes", gaussianWeightedLatitudes_ = true);
+    config.get("kdtree_cache_directory", kdtreeCacheDirectory_);
 }
 
 
@@ -137,7 +138,11 @@ void GridBoxMethod::do_setup(const Grid& source, const Grid& target, const Cache
     }
 
     if (not extractTreeFromCache(cache)) {
-        buildPointSearchTree(src);
+        // An on-disk tree that cannot be used is replaced by one built in memory
+        if (kdtreeCacheDirectory_.empty() ||
+            not extractTreeFromCache(IndexKDTreeCache(source, kdtreeCacheDirectory_))) {
+            buildPointSearchTree(src);
+        }
     }
 
     sourceBoxes_ = GridBoxes(source, gaussianWeightedLatitudes_);
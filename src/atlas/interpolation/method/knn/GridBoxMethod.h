@@ -14,6 +14,7 @@
 #include "atlas/interpolation/method/knn/KNearestNeighboursBase.h"
 
 #include <forward_list>
+#include <string>
 
 #include "atlas/functionspace.h"
 #include "atlas/interpolation/method/knn/GridBox.h"
@@ -67,6 +68,7 @@ protected:
     bool matrixFree_;
     bool failEarly_;
     bool gaussianWeightedLatitudes_;
+    std::string kdtreeCacheDirectory_;
 };
 
 
@@ -10,10 +10,8 @@
 
 #include "atlas/interpolation/method/knn/KNearestNeighbours.h"
 
-#include <limits>
-
-#include "eckit/log/Plural.h"
-#include "eckit/types/FloatCompare.h"
+#include <algorithm>
+#include <vector>
 
 #include "atlas/array.h"
 #include "atlas/functionspace/NodeColumns.h"
@@ -81,37 +79,34 @@ void KNearestNeighbours::do_setup(const FunctionSpace& source, const FunctionSpa
         return;
     }
 
-    // fill the sparse matrix
-    std::vector<Triplet> weights_triplets;
-    weights_triplets.reserve(out_npts * k_);
+    // find the closest input points to all output points at once
+    const size_t k = std::min(k_, pTree_.size());
+    ATLAS_ASSERT(k);
+    std::vector<idx_t> nn(out_npts * k);
+    std::vector<double> distances(out_npts * k);
     {
-        Trace timer(Here(), "atlas::interpolation::method::KNearestNeighbour::do_setup()");
-
-        std::vector<double> weights;
-
+        ATLAS_TRACE("atlas::interpolation::method::KNearestNeighbour::do_setup() search");
         Log::debug() << "Computing interpolation weights for " << out_npts << " points." << std::endl;
+        std::vector<PointLonLat> points(out_npts);
         for (size_t ip = 0; ip < out_npts; ++ip) {
-            if (ip && (ip % 1000 == 0)) {
-                timer.pause();
-                auto elapsed = timer.elapsed();
-                timer.resume();
-                auto rate = eckit::types::is_approximately_equal(elapsed, 0.) ? std::numeric_limits<double>::infinity()
-                                                                              : (ip / elapsed);
-                Log::debug() << eckit::BigNum(ip) << " (at " << size_t(rate) << " points/s)... after " << elapsed << " s" << std::endl;
-            }
+            points[ip] = PointLonLat{lonlat(ip, size_t(LON)), lonlat(ip, size_t(LAT))};
+        }
+        pTree_.closestPoints(points.data(), out_npts, k, nn.data(), distances.data());
+    }
 
-            // find the closest input points to the output point
-            auto nn = pTree_.closestPoints(PointLonLat{lonlat(ip, size_t(LON)), lonlat(ip, size_t(LAT))}, k_);
+    // fill the sparse matrix
+    std::vector<Triplet> weights_triplets;
+    weights_triplets.reserve(out_npts * k);
+    {
+        ATLAS_TRACE("atlas::interpolation::method::KNearestNeighbour::do_setup() weights");
 
+        std::vector<double> weights(k);
+        for (size_t ip = 0; ip < out_npts; ++ip) {
             // calculate weights (individual and total, to normalise) using distance
             // squared
-            const size_t npts = nn.size();
-            ATLAS_ASSERT(npts);
-            weights.resize(npts, 0);
-
             double sum = 0;
-            for (size_t j = 0; j < npts; ++j) {
-                const double d  = nn[j].distance();
+            for (size_t j = 0; j < k; ++j) {
+                const double d  = distances[ip * k + j];
                 const double d2 = d * d;
 
                 weights[j] = 1. / (1. + d2);
@@ -120,8 +115,8 @@ void KNearestNeighbours::do_setup(const FunctionSpace& source, const FunctionSpa
             ATLAS_ASSERT(sum > 0);
 
             // insert weights into the matrix
-            for (size_t j = 0; j < npts; ++j) {
-                size_t jp = nn[j].payload();
+            for (size_t j = 0; j < k; ++j) {
+                size_t jp = nn[ip * k + j];
                 ATLAS_ASSERT(jp < inp_npts,
                              "point found which is not covered within the halo of the source function space");
                 weights_triplets.emplace_back(ip, jp, weights[j] / sum);
@@ -10,10 +10,7 @@
 
 #include "atlas/interpolation/method/knn/NearestNeighbour.h"
 
-#include <limits>
-
-#include "eckit/log/Plural.h"
-#include "eckit/types/FloatCompare.h"
+#include <vector>
 
 #include "atlas/array.h"
 #include "atlas/functionspace/NodeColumns.h"
@@ -75,30 +72,26 @@ void NearestNeighbour::do_setup(const FunctionSpace& source, const FunctionSpace
         return;
     }
 
-    // fill the sparse matrix
-    std::vector<Triplet> weights_triplets;
-    weights_triplets.reserve(out_npts);
+    // find the closest input point to all output points at once
+    std::vector<idx_t> nn(out_npts);
     {
-        Trace timer(Here(), "atlas::interpolation::method::NearestNeighbour::do_setup()");
+        ATLAS_TRACE("atlas::interpolation::method::NearestNeighbour::do_setup() search");
+        std::vector<PointLonLat> points(out_npts);
         for (size_t ip = 0; ip < out_npts; ++ip) {
-            if (ip && (ip % 1000 == 0)) {
-                timer.pause();
-                auto elapsed = timer.elapsed();
-                timer.resume();
-                auto rate = eckit::types::is_approximately_equal(elapsed, 0.) ? std::numeric_limits<double>::infinity()
-                                                                              : (ip / elapsed);
-                Log::debug() << eckit::BigNum(ip) << " (at " << rate << " points/s)... after " << elapsed << " s" << std::endl;
-            }
-
-            // find the closest input point to the output point
-            auto nn   = pTree_.closestPoint(PointLonLat{lonlat(ip, size_t(LON)), lonlat(ip, size_t(LAT))});
-            size_t jp = nn.payload();
-
-            // insert the weights into the interpolant matrix
-            ATLAS_ASSERT(jp < inp_npts,
-                         "point found which is not covered within the halo of the source function space");
-            weights_triplets.emplace_back(ip, jp, 1);
+            points[ip] = PointLonLat{lonlat(ip, size_t(LON)), lonlat(ip, size_t(LAT))};
         }
+        pTree_.closestPoints(points.data(), out_npts, 1, nn.data());
+    }
+
+    // fill the sparse matrix
+    std::vector<Triplet> weights_triplets;
+    weights_triplets.reserve(out_npts);
+    for (size_t ip = 0; ip < out_npts; ++ip) {
+        size_t jp = nn[ip];
+
+        // insert the weights into the interpolant matrix
+        ATLAS_ASSERT(jp < inp_npts, "point found which is not covered within the halo of the source function space");
+        weights_triplets.emplace_back(ip, jp, 1);
     }
 
     // fill sparse matrix and return
@@ -12,6 +12,7 @@
 
 #include "StructuredInterpolation2D.h"
 
+#include <array>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -20,8 +21,10 @@
 #include <iomanip>
 #include <chrono>
 #include <thread>
+#include <vector>
 
 #include "eckit/filesystem/LocalPathName.h"
+#include "eckit/linalg/Triplet.h"
 
 #include "atlas/array/ArrayView.h"
 #include "atlas/field/Field.h"
@@ -215,6 +218,61 @@ namespace {
             ATLAS_THROW_EXCEPTION(err.str());
         }
     }
+
+    // Number of target points for which stencils and weights are computed together in matrix-free execution
+    constexpr idx_t block_size = 64;
+
+    // Stencil source indices and weights of a block of target points, in structure-of-arrays layout:
+    // entry (s,b) is at [s * block_size + b], for stencil point s and target point b of the block
+    template <typename Value>
+    struct StencilBlock {
+        StencilBlock(idx_t stencil_size): index(stencil_size * block_size), weight(stencil_size * block_size) {
+            points.reserve(block_size);
+        }
+        std::vector<idx_t> points;  // target points of the block that could be interpolated
+        std::vector<idx_t> index;
+        std::vector<Value> weight;
+    };
+
+    template <typename Value>
+    inline void apply_block(const StencilBlock<Value>& block, idx_t stencil_size,
+                            const array::ArrayView<const Value, 1>& input, array::ArrayView<Value, 1>& output) {
+        const idx_t nb_points = static_cast<idx_t>(block.points.size());
+        std::array<Value, block_size> result;
+        for (idx_t b = 0; b < nb_points; ++b) {
+            result[b] = 0.;
+        }
+        for (idx_t s = 0; s < stencil_size; ++s) {
+            const idx_t* index  = block.index.data() + s * block_size;
+            const Value* weight = block.weight.data() + s * block_size;
+            for (idx_t b = 0; b < nb_points; ++b) {
+                result[b] += weight[b] * input[index[b]];
+            }
+        }
+        for (idx_t b = 0; b < nb_points; ++b) {
+            output(block.points[b]) = result[b];
+        }
+    }
+
+    template <typename Value>
+    inline void apply_block(const StencilBlock<Value>& block, idx_t stencil_size,
+                            const array::ArrayView<const Value, 2>& input, array::ArrayView<Value, 2>& output) {
+        const idx_t nb_points = static_cast<idx_t>(block.points.size());
+        const idx_t Nk        = output.shape(1);
+        for (idx_t b = 0; b < nb_points; ++b) {
+            const idx_t r = block.points[b];
+            for (idx_t k = 0; k < Nk; ++k) {
+                output(r, k) = 0.;
+            }
+            for (idx_t s = 0; s < stencil_size; ++s) {
+                const idx_t n = block.index[s * block_size + b];
+                const Value w = block.weight[s * block_size + b];
+                for (idx_t k = 0; k < Nk; ++k) {
+                    output(r, k) += w * input(n, k);
+                }
+            }
+        }
+    }
 }
 }
 
@@ -520,7 +578,7 @@ void StructuredInterpolation2D<Kernel>::execute_impl( const Kernel& kernel, cons
 
     std::vector<idx_t> failed_points;
 
-    auto interpolate_omp = [&failed_points,interpolate_point]( idx_t out_npts, auto lonlat, auto ghost) {
+    auto interpolate_pointwise = [&failed_points,interpolate_point]( idx_t out_npts, auto lonlat, auto ghost) {
         atlas_omp_parallel {
             WorkSpace workspace;
             atlas_omp_for( idx_t n = 0; n < out_npts; ++n ) {
@@ -535,6 +593,68 @@ void StructuredInterpolation2D<Kernel>::execute_impl( const Kernel& kernel, cons
         }
     };
 
+    // Stencils and weights are first computed for a whole block of target points, and then applied to all
+    // fields and levels in one pass with inner loops over the block points or levels, which vectorise.
+    // The weights are the ones the matrix would contain, so results are the same as point by point.
+    auto interpolate_blocks = [&]( idx_t out_npts, auto lonlat, auto ghost) {
+        constexpr idx_t stencil_size = Kernel::stencil_size();
+        const idx_t nb_blocks        = ( out_npts + block_size - 1 ) / block_size;
+        atlas_omp_parallel {
+            WorkSpace workspace;
+            StencilBlock<Value> block( stencil_size );
+            std::vector<eckit::linalg::Triplet> triplets( stencil_size * block_size );
+            std::vector<idx_t> thread_failed_points;
+            atlas_omp_for( idx_t jblock = 0; jblock < nb_blocks; ++jblock ) {
+                const idx_t begin = jblock * block_size;
+                const idx_t end   = std::min( begin + block_size, out_npts );
+                block.points.clear();
+                for ( idx_t n = begin; n < end; ++n ) {
+                    if ( ghost(n) ) {
+                        continue;
+                    }
+                    PointLonLat p = lonlat(n);
+                    try {
+                        kernel.insert_triplets( static_cast<idx_t>( block.points.size() ), p, triplets, workspace );
+                        block.points.emplace_back( n );
+                        continue;
+                    }
+                    catch(const eckit::Exception& e) {}
+                    if (verbose_) {
+                        Log::error() << "Could not interpolate point " << n << " :\t" << p << std::endl;
+                    }
+                    thread_failed_points.emplace_back( n );
+                }
+                const idx_t nb_points = static_cast<idx_t>( block.points.size() );
+                for ( idx_t b = 0; b < nb_points; ++b ) {
+                    for ( idx_t s = 0; s < stencil_size; ++s ) {
+                        const auto& triplet              = triplets[b * stencil_size + s];
+                        block.index[s * block_size + b]  = static_cast<idx_t>( triplet.col() );
+                        block.weight[s * block_size + b] = static_cast<Value>( triplet.value() );
+                    }
+                }
+                for ( idx_t i = 0; i < N; ++i ) {
+                    apply_block( block, stencil_size, src_view[i], tgt_view[i] );
+                }
+            }
+            if ( not thread_failed_points.empty() ) {
+                atlas_omp_critical {
+                    failed_points.insert( failed_points.end(), thread_failed_points.begin(), thread_failed_points.end() );
+                }
+            }
+        }
+        std::sort( failed_points.begin(), failed_points.end() );
+    };
+
+    // The limiter needs the stencil values of each point, and is only applied point by point
+    auto interpolate_omp = [&]( idx_t out_npts, auto lonlat, auto ghost) {
+        if ( kernel.limiter() ) {
+            interpolate_pointwise( out_npts, lonlat, ghost );
+        }
+        else {
+            interpolate_blocks( out_npts, lonlat, ghost );
+        }
+    };
+
     if ( target_lonlat_ ) {
         auto lonlat_view    = array::make_view<double, 2>( target_lonlat_ );
         auto lonlat = [lonlat_view, convert_units = convert_units_] (idx_t n) {
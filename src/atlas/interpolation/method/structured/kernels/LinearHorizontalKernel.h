@@ -50,6 +50,9 @@ public:
     static constexpr idx_t stencil_size() { return stencil_width() * stencil_width(); }
     static constexpr idx_t stencil_halo() { return 0; }
 
+    /// @brief Linear interpolation is never limited
+    bool limiter() const { return false; }
+
 public:
     using Stencil = grid::HorizontalStencil<2>;
     struct Weights {
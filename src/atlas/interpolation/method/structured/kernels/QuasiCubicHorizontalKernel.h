@@ -60,6 +60,9 @@ public:
         return static_cast<idx_t>(static_cast<double>(stencil_width()) / 2. + 0.5);
     }
 
+    /// @brief True if interpolated values are limited to the range of the stencil values
+    bool limiter() const { return limiter_; }
+
 public:
     using Stencil = grid::HorizontalStencil<4>;
     struct Weights {
@@ -8,8 +8,10 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
+#include <set>
 #include <vector>
 #include <sys/stat.h> // for mkdir
 
@@ -949,18 +951,45 @@ void ConservativeSphericalPolygonInterpolation::intersect_polygons(const CSPolyg
         return false;
     };
 
-    std::set<PointXYZ, decltype(compare_pointxyz)> src_cent(compare_pointxyz);
-    auto src_already_in = [&](const PointXYZ& halo_cent) {
-        if (src_cent.find(halo_cent) == src_cent.end()) {
-            atlas_omp_critical{
-              src_cent.insert(halo_cent);
-            }
-            return false;
+    // Source cells with the centroid of a preceding source cell (e.g. periodic copies) are skipped.
+    // This is decided up front in source cell order, so that the result does not depend on the threads.
+    std::vector<char> src_already_in(src_csp.size(), 0);
+    {
+        std::set<PointXYZ, decltype(compare_pointxyz)> src_cent(compare_pointxyz);
+        for (idx_t scell = 0; scell < src_csp.size(); ++scell) {
+            src_already_in[scell] = not src_cent.insert(std::get<0>(src_csp[scell]).centroid()).second;
         }
-        return true;
-    };
+    }
     stopwatch_src_already_in.stop();
 
+    // Candidate target cells of each source cell
+    std::vector<std::vector<idx_t>> src_candidates(src_csp.size());
+    stopwatch_kdtree_search.start();
+    atlas_omp_parallel_for (idx_t scell = 0; scell < src_csp.size(); ++scell) {
+        if (not src_already_in[scell]) {
+            const auto& s_csp = std::get<0>(src_csp[scell]);
+            auto tgt_cells = kdt_search.closestPointsWithinRadius(s_csp.centroid(), s_csp.radius() + max_tgtcell_rad);
+            auto& candidates = src_candidates[scell];
+            candidates.reserve(tgt_cells.size());
+            for (idx_t ttcell = 0; ttcell < tgt_cells.size(); ++ttcell) {
+                candidates.emplace_back(tgt_cells[ttcell].payload());
+            }
+        }
+    }
+    stopwatch_kdtree_search.stop();
+
+    // The cost of a source cell is estimated by its number of candidates: most expensive cells go first
+    std::vector<idx_t> src_order;
+    src_order.reserve(src_csp.size());
+    for (idx_t scell = 0; scell < src_csp.size(); ++scell) {
+        if (not src_already_in[scell]) {
+            src_order.emplace_back(scell);
+        }
+    }
+    std::stable_sort(src_order.begin(), src_order.end(), [&src_candidates](idx_t a, idx_t b) {
+        return src_candidates[a].size() > src_candidates[b].size();
+    });
+
     enum MeshSizeId
     {
         SRC,
@@ -995,31 +1024,32 @@ void ConservativeSphericalPolygonInterpolation::intersect_polygons(const CSPolyg
     constexpr double pointsSameEPS = 5.e6 * std::numeric_limits<double>::epsilon();
 
     eckit::Channel blackhole;
-    eckit::ProgressTimer progress("Intersecting polygons ", src_csp.size() / atlas_omp_get_max_threads(), " (cell/thread)", double(10),
-                                  src_csp.size() / atlas_omp_get_max_threads() > 50 ? Log::info() : blackhole);
-    atlas_omp_parallel_for (idx_t scell = 0; scell < src_csp.size(); ++scell) {
-        if ( atlas_omp_get_thread_num() == 0 ) {
-            ++progress;
-            stopwatch_src_already_in.start();
-        }
-        bool already_in = src_already_in((std::get<0>(src_csp[scell]).centroid()));
-        if ( atlas_omp_get_thread_num() == 0 ) {
-            stopwatch_src_already_in.stop();
-        }
-        if (not already_in) {
+    eckit::ProgressTimer progress("Intersecting polygons ", src_order.size() / atlas_omp_get_max_threads(), " (cell/thread)", double(10),
+                                  src_order.size() / atlas_omp_get_max_threads() > 50 ? Log::info() : blackhole);
+    Triplets tgt_triplets;  // (tcell, scell, intersection area), only used for debugging
+    atlas_omp_parallel {
+        // Results shared between source cells are gathered per thread, and merged once at the end
+        Triplets tgt_triplets_thread;
+        std::array<size_t, 4> num_pol_thread{0, 0, 0, 0};
+        std::array<double, 2> area_coverage_thread{0., 0.};
+
+        atlas_omp_pragma(omp for schedule(dynamic, 16) nowait)
+        for (size_t jcell = 0; jcell < src_order.size(); ++jcell) {
+            const idx_t scell = src_order[jcell];
+            if ( atlas_omp_get_thread_num() == 0 ) {
+                ++progress;
+            }
             const auto& s_csp       = std::get<0>(src_csp[scell]);
             const double s_csp_area = s_csp.area();
             double src_cover_area   = 0.;
 
-            stopwatch_kdtree_search.start();
-            auto tgt_cells = kdt_search.closestPointsWithinRadius(s_csp.centroid(), s_csp.radius() + max_tgtcell_rad);
-            stopwatch_kdtree_search.stop();
+            const auto& tgt_cells = src_candidates[scell];
             for (idx_t ttcell = 0; ttcell < tgt_cells.size(); ++ttcell) {
-                auto tcell        = tgt_cells[ttcell].payload();
+                auto tcell        = tgt_cells[ttcell];
                 const auto& t_csp = std::get<0>(tgt_csp[tcell]);
                 if( atlas_omp_get_thread_num() == 0 ) {
                     stopwatch_polygon_intersections.start();
-               }
+                }
                 ConvexSphericalPolygon csp_i = s_csp.intersect(t_csp, nullptr, pointsSameEPS);
                 double csp_i_area            = csp_i.area();
                 if( atlas_omp_get_thread_num() == 0 ) {
@@ -1032,10 +1062,7 @@ void ConservativeSphericalPolygonInterpolation::intersect_polygons(const CSPolyg
                         dump_intersection("Zero area intersections with inside_vertices", s_csp, tgt_csp, tgt_cells);
                     }
                     // TODO: assuming intersector search works fine, this should be move under "if (csp_i_area > 0)"
-                    atlas_omp_critical {
-                        tgt_iparam[tcell].cell_idx.emplace_back(scell);
-                        tgt_iparam[tcell].tgt_weights.emplace_back(csp_i_area);
-                    }
+                    tgt_triplets_thread.emplace_back(tcell, scell, csp_i_area);
                 }
                 if (csp_i_area > 0) {
                     src_iparam_[scell].cell_idx.emplace_back(tcell);
@@ -1066,17 +1093,13 @@ void ConservativeSphericalPolygonInterpolation::intersect_polygons(const CSPolyg
                 if (validate_ and mpi::size() == 1) {
                     dump_intersection("Source cell not exactly covered", s_csp, tgt_csp, tgt_cells);
                     if (statistics_intersection_) {
-                        atlas_omp_critical{
-                            area_coverage[TOTAL_SRC] += src_cover_err;
-                            area_coverage[MAX_SRC] = std::max(area_coverage[MAX_SRC], src_cover_err);
-                        }
+                        area_coverage_thread[TOTAL_SRC] += src_cover_err;
+                        area_coverage_thread[MAX_SRC] = std::max(area_coverage_thread[MAX_SRC], src_cover_err);
                     }
                 }
             }
             if (src_iparam_[scell].cell_idx.size() == 0 and statistics_intersection_) {
-                atlas_omp_critical{
-                    num_pol[SRC_NONINTERSECT]++;
-                }
+                num_pol_thread[SRC_NONINTERSECT]++;
             }
             if (normalise_intersections_ && src_cover_err_percent < 1.) {
                 double wfactor = s_csp.area() / (src_cover_area > 0. ? src_cover_area : 1.);
@@ -1086,11 +1109,28 @@ void ConservativeSphericalPolygonInterpolation::intersect_polygons(const CSPolyg
                 }
             }
             if (statistics_intersection_) {
-                atlas_omp_critical{
-                    num_pol[SRC_TGT_INTERSECT] += src_iparam_[scell].weights.size();
-                }
+                num_pol_thread[SRC_TGT_INTERSECT] += src_iparam_[scell].weights.size();
+            }
+        }
+
+        atlas_omp_critical {
+            tgt_triplets.insert(tgt_triplets.end(), tgt_triplets_thread.begin(), tgt_triplets_thread.end());
+            for (size_t j = 0; j < num_pol.size(); ++j) {
+                num_pol[j] += num_pol_thread[j];
             }
-        } // already in
+            area_coverage[TOTAL_SRC] += area_coverage_thread[TOTAL_SRC];
+            area_coverage[MAX_SRC] = std::max(area_coverage[MAX_SRC], area_coverage_thread[MAX_SRC]);
+        }
+    }
+    if (validate_) {
+        // source cells per target cell in ascending order, independent of the thread schedule
+        std::sort(tgt_triplets.begin(), tgt_triplets.end(), [](const Triplet& a, const Triplet& b) {
+            return a.row() != b.row() ? a.row() < b.row() : a.col() < b.col();
+        });
+        for (const auto& triplet : tgt_triplets) {
+            tgt_iparam[triplet.row()].cell_idx.emplace_back(triplet.col());
+            tgt_iparam[triplet.row()].tgt_weights.emplace_back(triplet.value());
+        }
     }
     timings.polygon_intersections  = stopwatch_polygon_intersections.elapsed();
     timings.target_kdtree_search   = stopwatch_kdtree_search.elapsed();
@@ -15,6 +15,7 @@
 #include "eckit/types/FloatCompare.h"
 
 #include "atlas/field/MissingValue.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/util/DataType.h"
 
 
@@ -56,6 +57,138 @@ bool Missing::applicable(const Field& f) const {
     return field::MissingValue(f);
 }
 
+namespace {
+
+enum class Policy
+{
+    IfAllMissing,
+    IfAnyMissing,
+    IfHeaviestMissing,
+};
+
+// Equivalent to applying the weights redistribution of the execute() functions below to a copy of W,
+// followed by a sparse matrix multiplication, for every level of the source field.
+template <typename T, Policy policy>
+void interpolate_missingT(const NonLinear::Matrix& W, const Field& src, Field& tgt) {
+    using Scalar = NonLinear::Scalar;
+
+    field::MissingValue mv(src);
+    auto& missingValue = mv.ref();
+
+    ATLAS_ASSERT(src.rank() == tgt.rank());
+    ATLAS_ASSERT(src.shape(0) >= idx_t(W.cols()));
+    ATLAS_ASSERT(tgt.shape(0) >= idx_t(W.rows()));
+
+    const T* src_data;
+    T* tgt_data;
+    idx_t src_stride, tgt_stride;
+    idx_t src_level_stride = 0;
+    idx_t tgt_level_stride = 0;
+    idx_t levels           = 1;
+    if (src.rank() == 1) {
+        auto src_v = array::make_view<T, 1>(src);
+        auto tgt_v = array::make_view<T, 1>(tgt);
+        src_data   = src_v.data();
+        tgt_data   = tgt_v.data();
+        src_stride = src_v.stride(0);
+        tgt_stride = tgt_v.stride(0);
+    }
+    else {
+        auto src_v       = array::make_view<T, 2>(src);
+        auto tgt_v       = array::make_view<T, 2>(tgt);
+        src_data         = src_v.data();
+        tgt_data         = tgt_v.data();
+        src_stride       = src_v.stride(0);
+        tgt_stride       = tgt_v.stride(0);
+        src_level_stride = src_v.stride(1);
+        tgt_level_stride = tgt_v.stride(1);
+        levels           = src_v.shape(1);
+        ATLAS_ASSERT(tgt_v.shape(1) == levels);
+    }
+
+    const auto outer  = W.outer();
+    const auto index  = W.inner();
+    const auto weight = W.data();
+    const idx_t rows  = static_cast<idx_t>(W.rows());
+
+    atlas_omp_parallel_for(idx_t r = 0; r < rows; ++r) {
+        const auto begin = outer[r];
+        const auto end   = outer[r + 1];
+        for (idx_t k = 0; k < levels; ++k) {
+            const T* src_k = src_data + k * src_level_stride;
+
+            // count missing values, accumulate weights and weighted values (disregarding missing values)
+            auto j_missing           = begin;
+            size_t N_missing         = 0;
+            Scalar sum               = 0.;
+            Scalar value             = 0.;
+            Scalar heaviest          = -1.;
+            bool heaviest_is_missing = false;
+            for (auto j = begin; j < end; ++j) {
+                const T v       = src_k[index[j] * src_stride];
+                const bool miss = missingValue(v);
+                if (miss) {
+                    ++N_missing;
+                    j_missing = j;
+                }
+                else {
+                    sum += weight[j];
+                    value += weight[j] * v;
+                }
+                if (policy == Policy::IfHeaviestMissing && heaviest < weight[j]) {
+                    heaviest            = weight[j];
+                    heaviest_is_missing = miss;
+                }
+            }
+
+            T& result = tgt_data[r * tgt_stride + k * tgt_level_stride];
+            if (N_missing == 0) {
+                result = static_cast<T>(value);
+            }
+            else if (policy == Policy::IfAnyMissing || N_missing == size_t(end - begin) ||
+                     (policy == Policy::IfHeaviestMissing && heaviest_is_missing) ||
+                     eckit::types::is_approximately_equal(sum, 0.)) {
+                // result is the (last) missing value in the row
+                result = src_k[index[j_missing] * src_stride];
+            }
+            else {
+                result = static_cast<T>(value / sum);
+            }
+        }
+    }
+}
+
+template <Policy policy>
+bool interpolate_missing(const NonLinear::Matrix& W, const Field& src, Field& tgt) {
+    if (src.rank() > 2 || src.datatype() != tgt.datatype()) {
+        return false;
+    }
+    switch (src.datatype().kind()) {
+        case (DataType::kind<double>()):
+            interpolate_missingT<double, policy>(W, src, tgt);
+            return true;
+        case (DataType::kind<float>()):
+            interpolate_missingT<float, policy>(W, src, tgt);
+            return true;
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
+bool MissingIfAllMissing::interpolate(const NonLinear::Matrix& W, const Field& src, Field& tgt) const {
+    return interpolate_missing<Policy::IfAllMissing>(W, src, tgt);
+}
+
+bool MissingIfAnyMissing::interpolate(const NonLinear::Matrix& W, const Field& src, Field& tgt) const {
+    return interpolate_missing<Policy::IfAnyMissing>(W, src, tgt);
+}
+
+bool MissingIfHeaviestMissing::interpolate(const NonLinear::Matrix& W, const Field& src, Field& tgt) const {
+    return interpolate_missing<Policy::IfHeaviestMissing>(W, src, tgt);
+}
+
 bool MissingIfAllMissing::execute(NonLinear::Matrix& W, const Field& field) const {
     switch(field.datatype().kind()) {
         case (DataType::kind<double>()):        return executeT<double>(W,field);
@@ -29,6 +29,8 @@ private:
 struct MissingIfAllMissing : Missing {
     bool execute(NonLinear::Matrix& W, const Field& field) const override;
 
+    bool interpolate(const NonLinear::Matrix& W, const Field& src, Field& tgt) const override;
+
     template<typename T>
     bool executeT(NonLinear::Matrix& W, const Field& field) const;
 
@@ -39,6 +41,8 @@ struct MissingIfAllMissing : Missing {
 struct MissingIfAnyMissing : Missing {
     bool execute(NonLinear::Matrix& W, const Field& field) const override;
 
+    bool interpolate(const NonLinear::Matrix& W, const Field& src, Field& tgt) const override;
+
     template<typename T>
     bool executeT(NonLinear::Matrix& W, const Field& field) const;
 
@@ -49,6 +53,8 @@ struct MissingIfAnyMissing : Missing {
 struct MissingIfHeaviestMissing : Missing {
     bool execute(NonLinear::Matrix& W, const Field& field) const override;
 
+    bool interpolate(const NonLinear::Matrix& W, const Field& src, Field& tgt) const override;
+
     template<typename T>
     bool executeT(NonLinear::Matrix& W, const Field& field) const;
 
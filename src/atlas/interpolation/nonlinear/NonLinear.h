@@ -66,6 +66,16 @@ public:
      */
     virtual bool execute(Matrix& W, const Field& f) const = 0;
 
+    /**
+     * @brief Interpolate a field, applying the non-linear corrections to each row of the interpolation matrix on the
+     * fly, without modifying or copying the matrix
+     * @param [in] W interpolation matrix
+     * @param [in] src source field with missing values information, of rank 1 or 2
+     * @param [inout] tgt target field, of same rank and datatype as src
+     * @return if the interpolation was done; if not, corrections need to be applied to a copy of W with execute()
+     */
+    virtual bool interpolate(const Matrix& /*W*/, const Field& /*src*/, Field& /*tgt*/) const { return false; }
+
 protected:
     template <typename Value, int Rank>
     static array::ArrayView<typename std::add_const<Value>::type, Rank> make_view_field_values(const Field& field) {
@@ -62,3 +62,4 @@ struct MatrixMultiply {
 
 #include "MatrixMultiply.tcc"
 #include "MatrixMultiply_EckitLinalg.h"
+#include "MatrixMultiply_Float.h"
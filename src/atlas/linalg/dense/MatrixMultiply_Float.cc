@@ -0,0 +1,82 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "MatrixMultiply_Float.h"
+
+#include <algorithm>
+
+#include "atlas/library/config.h"
+
+#if ATLAS_HAVE_EIGEN
+#include <Eigen/Core>
+#endif
+
+namespace atlas {
+namespace linalg {
+namespace dense {
+
+namespace {
+
+#if !ATLAS_HAVE_EIGEN
+// Blocks of A of (block_m x block_k) floats stay in cache while all columns of B and C pass
+constexpr idx_t block_m = 256;
+constexpr idx_t block_k = 64;
+
+void sgemm_blocked(const float A[], const float B[], float C[], idx_t m, idx_t n, idx_t k) {
+    std::fill(C, C + size_t(m) * n, 0.f);
+    for (idx_t l0 = 0; l0 < k; l0 += block_k) {
+        const idx_t l1 = std::min(l0 + block_k, k);
+        for (idx_t i0 = 0; i0 < m; i0 += block_m) {
+            const idx_t i1 = std::min(i0 + block_m, m);
+            for (idx_t j = 0; j < n; ++j) {
+                float* c       = C + size_t(m) * j;
+                const float* b = B + size_t(k) * j;
+                idx_t l        = l0;
+                // four columns of A at a time, so that each element of C is loaded and stored once per four updates
+                for (; l + 4 <= l1; l += 4) {
+                    const float* a0 = A + size_t(m) * l;
+                    const float* a1 = a0 + m;
+                    const float* a2 = a1 + m;
+                    const float* a3 = a2 + m;
+                    const float b0 = b[l], b1 = b[l + 1], b2 = b[l + 2], b3 = b[l + 3];
+                    for (idx_t i = i0; i < i1; ++i) {
+                        c[i] += a0[i] * b0 + a1[i] * b1 + a2[i] * b2 + a3[i] * b3;
+                    }
+                }
+                for (; l < l1; ++l) {
+                    const float* a = A + size_t(m) * l;
+                    const float bl = b[l];
+                    for (idx_t i = i0; i < i1; ++i) {
+                        c[i] += a[i] * bl;
+                    }
+                }
+            }
+        }
+    }
+}
+#endif
+
+}  // namespace
+
+void sgemm(const float A[], const float B[], float C[], idx_t m, idx_t n, idx_t k, const eckit::Configuration&) {
+#if ATLAS_HAVE_EIGEN
+    using MatrixXf = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor>;
+    Eigen::Map<const MatrixXf> mA(A, m, k);
+    Eigen::Map<const MatrixXf> mB(B, k, n);
+    Eigen::Map<MatrixXf> mC(C, m, n);
+    mC.noalias() = mA * mB;
+#else
+    sgemm_blocked(A, B, C, m, n, k);
+#endif
+}
+
+}  // namespace dense
+}  // namespace linalg
+}  // namespace atlas
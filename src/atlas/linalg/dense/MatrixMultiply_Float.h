@@ -0,0 +1,29 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include "eckit/config/Configuration.h"
+
+#include "atlas/library/config.h"
+
+namespace atlas {
+namespace linalg {
+namespace dense {
+
+/// @brief Single precision C = A . B, with column-major matrices A (m x k), B (k x n) and C (m x n)
+///
+/// The eckit_linalg backends only support double precision. This uses the single precision GEMM of
+/// Eigen when atlas is built with Eigen, and a cache-blocked implementation otherwise.
+void sgemm(const float A[], const float B[], float C[], idx_t m, idx_t n, idx_t k, const eckit::Configuration&);
+
+}  // namespace dense
+}  // namespace linalg
+}  // namespace atlas
@@ -38,6 +38,27 @@ template <typename Matrix, typename SourceView, typename TargetView>
 void sparse_matrix_multiply(const Matrix& matrix, const SourceView& src, TargetView& tgt, Indexing,
                             const Configuration& config);
 
+/// @brief Transposed sparse matrix multiply-add: tgt += matrix^T * src
+///
+/// The product is computed from the compressed row storage of the matrix, so no transposed copy of the matrix is
+/// stored. When the rows of different threads reference largely disjoint columns, partial sums are kept per thread;
+/// otherwise only the sparsity pattern is transposed. The analysis of the sparsity pattern, including its transpose,
+/// is cached for the most recently used matrices, and the per-thread buffers are reused across calls. It is only
+/// implemented by the openmp backend, which is used regardless of the configured backend.
+template <typename Matrix, typename SourceView, typename TargetView>
+void sparse_matrix_multiply_add_transpose(const Matrix& matrix, const SourceView& src, TargetView& tgt);
+
+template <typename Matrix, typename SourceView, typename TargetView>
+void sparse_matrix_multiply_add_transpose(const Matrix& matrix, const SourceView& src, TargetView& tgt,
+                                          const Configuration& config);
+
+template <typename Matrix, typename SourceView, typename TargetView>
+void sparse_matrix_multiply_add_transpose(const Matrix& matrix, const SourceView& src, TargetView& tgt, Indexing);
+
+template <typename Matrix, typename SourceView, typename TargetView>
+void sparse_matrix_multiply_add_transpose(const Matrix& matrix, const SourceView& src, TargetView& tgt, Indexing,
+                                          const Configuration& config);
+
 class SparseMatrixMultiply {
 public:
     SparseMatrixMultiply() = default;
@@ -70,6 +91,16 @@ struct SparseMatrixMultiply {
         throw_NotImplemented("SparseMatrixMultiply needs a template specialization with the implementation", Here());
     }
 };
+
+// Template class which needs (full or partial) specialization for concrete template parameters
+template <typename Backend, Indexing, int Rank, typename SourceValue, typename TargetValue>
+struct SparseMatrixMultiplyAddTranspose {
+    static void apply(const SparseMatrix&, const View<SourceValue, Rank>&, View<TargetValue, Rank>&,
+                      const Configuration&) {
+        throw_NotImplemented(
+            "SparseMatrixMultiplyAddTranspose needs a template specialization with the implementation", Here());
+    }
+};
 }  // namespace sparse
 
 }  // namespace linalg
@@ -44,6 +44,43 @@ struct SparseMatrixMultiplyHelper {
     }
 };
 
+template <typename Backend, Indexing indexing>
+struct SparseMatrixMultiplyAddTransposeHelper {
+    template <typename SourceView, typename TargetView>
+    static void apply( const SparseMatrix& W, const SourceView& src, TargetView& tgt,
+                       const eckit::Configuration& config ) {
+        using SourceValue = const typename std::remove_const<typename SourceView::value_type>::type;
+        using TargetValue = typename std::remove_const<typename TargetView::value_type>::type;
+        constexpr int src_rank = introspection::rank<SourceView>();
+        constexpr int tgt_rank = introspection::rank<TargetView>();
+        static_assert( src_rank == tgt_rank, "src and tgt need same rank" );
+        SparseMatrixMultiplyAddTranspose<Backend, indexing, src_rank, SourceValue, TargetValue>::apply( W, src, tgt, config );
+    }
+};
+
+template <typename Backend, typename Matrix, typename SourceView, typename TargetView>
+void dispatch_sparse_matrix_multiply_add_transpose( const Matrix& matrix, const SourceView& src, TargetView& tgt,
+                                                    Indexing indexing, const eckit::Configuration& config ) {
+    auto src_v = make_view( src );
+    auto tgt_v = make_view( tgt );
+
+    if ( introspection::layout_right( src ) || introspection::layout_right( tgt ) ) {
+        ATLAS_ASSERT( introspection::layout_right( src ) && introspection::layout_right( tgt ) );
+        SparseMatrixMultiplyAddTransposeHelper<Backend, linalg::Indexing::layout_right>::apply( matrix, src_v, tgt_v, config );
+    }
+    else {
+        if( indexing == Indexing::layout_left ) {
+            SparseMatrixMultiplyAddTransposeHelper<Backend, Indexing::layout_left>::apply( matrix, src_v, tgt_v, config );
+        }
+        else if( indexing == Indexing::layout_right ) {
+            SparseMatrixMultiplyAddTransposeHelper<Backend, Indexing::layout_right>::apply( matrix, src_v, tgt_v, config );
+        }
+        else {
+            throw_NotImplemented( "indexing not implemented", Here() );
+        }
+    }
+}
+
 template <typename Backend, typename Matrix, typename SourceView, typename TargetView>
 void dispatch_sparse_matrix_multiply( const Matrix& matrix, const SourceView& src, TargetView& tgt, Indexing indexing,
                                       const eckit::Configuration& config ) {
@@ -108,6 +145,30 @@ void sparse_matrix_multiply( const Matrix& matrix, const SourceView& src, Target
     sparse_matrix_multiply( matrix, src, tgt, Indexing::layout_left );
 }
 
+template <typename Matrix, typename SourceView, typename TargetView>
+void sparse_matrix_multiply_add_transpose( const Matrix& matrix, const SourceView& src, TargetView& tgt,
+                                           Indexing indexing, const eckit::Configuration& config ) {
+    // Only the openmp backend provides the transposed product
+    sparse::dispatch_sparse_matrix_multiply_add_transpose<sparse::backend::openmp>( matrix, src, tgt, indexing, config );
+}
+
+template <typename Matrix, typename SourceView, typename TargetView>
+void sparse_matrix_multiply_add_transpose( const Matrix& matrix, const SourceView& src, TargetView& tgt,
+                                           const eckit::Configuration& config ) {
+    sparse_matrix_multiply_add_transpose( matrix, src, tgt, Indexing::layout_left, config );
+}
+
+template <typename Matrix, typename SourceView, typename TargetView>
+void sparse_matrix_multiply_add_transpose( const Matrix& matrix, const SourceView& src, TargetView& tgt,
+                                           Indexing indexing ) {
+    sparse_matrix_multiply_add_transpose( matrix, src, tgt, indexing, sparse::Backend() );
+}
+
+template <typename Matrix, typename SourceView, typename TargetView>
+void sparse_matrix_multiply_add_transpose( const Matrix& matrix, const SourceView& src, TargetView& tgt ) {
+    sparse_matrix_multiply_add_transpose( matrix, src, tgt, Indexing::layout_left );
+}
+
 }  // namespace linalg
 }  // namespace atlas
 
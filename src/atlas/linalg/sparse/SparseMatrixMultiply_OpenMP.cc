@@ -10,13 +10,293 @@
 
 #include "atlas/linalg/sparse/SparseMatrixMultiply_OpenMP.h"
 
+#include <algorithm>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 #include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
 
 namespace atlas {
 namespace linalg {
 namespace sparse {
 
+namespace {
+
+// Analysis of the sparsity pattern of a matrix for multiply_add_transpose with a given number of threads.
+//
+// Rows are split in contiguous blocks, one per thread, and the range of columns referenced by each block is recorded.
+// When these ranges overlap little, as for interpolation matrices whose rows follow the target ordering, each thread
+// accumulates in a private buffer that spans its range of columns. The combined size of the buffers is capped at
+// twice the size of the target. Above the cap, e.g. when the rows reference columns scattered over the whole range,
+// the sparsity pattern is transposed instead, so that each column gathers its contributions in row order.
+struct TransposePlan {
+    using Index = eckit::linalg::Index;
+
+    int nb_threads;
+    std::vector<idx_t> row_begin;  // first row of each thread, and the number of rows
+    std::vector<idx_t> col_begin;  // first column referenced by each thread
+    std::vector<idx_t> col_end;    // one past the last column referenced by each thread
+    bool use_buffers;
+
+    // Transposed sparsity pattern, only when use_buffers is false: for each column, the rows and the positions of
+    // the nonzeros referencing it, in row order
+    std::vector<size_t> t_outer;
+    std::vector<idx_t> t_row;
+    std::vector<Index> t_nonzero;
+
+    TransposePlan(const SparseMatrix& W, int _nb_threads): nb_threads(_nb_threads) {
+        ATLAS_TRACE("multiply_add_transpose plan");
+        const auto outer = W.outer();
+        const auto index = W.inner();
+        const idx_t rows = static_cast<idx_t>(W.rows());
+        const idx_t cols = static_cast<idx_t>(W.cols());
+
+        row_begin.resize(nb_threads + 1);
+        for (int thread = 0; thread <= nb_threads; ++thread) {
+            row_begin[thread] = static_cast<idx_t>((size_t(rows) * thread) / nb_threads);
+        }
+
+        col_begin.assign(nb_threads, 0);
+        col_end.assign(nb_threads, 0);
+        atlas_omp_parallel_for(int thread = 0; thread < nb_threads; ++thread) {
+            const auto c_begin = outer[row_begin[thread]];
+            const auto c_end   = outer[row_begin[thread + 1]];
+            if (c_end > c_begin) {
+                idx_t n_begin = std::numeric_limits<idx_t>::max();
+                idx_t n_end   = 0;
+                for (auto c = c_begin; c < c_end; ++c) {
+                    n_begin = std::min<idx_t>(n_begin, index[c]);
+                    n_end   = std::max<idx_t>(n_end, index[c] + 1);
+                }
+                col_begin[thread] = n_begin;
+                col_end[thread]   = n_end;
+            }
+        }
+
+        size_t span = 0;
+        for (int thread = 0; thread < nb_threads; ++thread) {
+            span += size_t(col_end[thread] - col_begin[thread]);
+        }
+        use_buffers = span <= 2 * size_t(cols);
+        if (use_buffers) {
+            return;
+        }
+
+        const size_t nnz = size_t(outer[rows]);
+        t_outer.assign(size_t(cols) + 1, 0);
+        for (size_t c = 0; c < nnz; ++c) {
+            ++t_outer[size_t(index[c]) + 1];
+        }
+        for (idx_t n = 0; n < cols; ++n) {
+            t_outer[n + 1] += t_outer[n];
+        }
+        t_row.resize(nnz);
+        t_nonzero.resize(nnz);
+        std::vector<size_t> pos(t_outer.begin(), t_outer.end() - 1);
+        for (idx_t r = 0; r < rows; ++r) {
+            for (auto c = outer[r]; c < outer[r + 1]; ++c) {
+                const size_t p = pos[index[c]]++;
+                t_row[p]       = r;
+                t_nonzero[p]   = c;
+            }
+        }
+    }
+};
+
+// Identifies a matrix by its storage, its shape and a sample of its sparsity pattern. The sample tells apart a
+// matrix that reuses the storage of a deleted matrix of the same shape.
+struct TransposePlanKey {
+    const void* outer;
+    const void* inner;
+    size_t rows;
+    size_t cols;
+    size_t nnz;
+    size_t sample;
+    int nb_threads;
+
+    TransposePlanKey(const SparseMatrix& W, int _nb_threads):
+        outer(W.outer()),
+        inner(W.inner()),
+        rows(W.rows()),
+        cols(W.cols()),
+        nnz(W.nonZeros()),
+        sample(0),
+        nb_threads(_nb_threads) {
+        constexpr size_t nb_samples = 64;
+        auto combine                = [this](size_t value) {
+            sample ^= value + 0x9e3779b97f4a7c15ul + (sample << 6) + (sample >> 2);
+        };
+        for (size_t s = 0; s < nb_samples; ++s) {
+            combine(size_t(W.outer()[(rows * s) / (nb_samples - 1)]));
+            if (nnz > 0) {
+                combine(size_t(W.inner()[((nnz - 1) * s) / (nb_samples - 1)]));
+            }
+        }
+    }
+
+    bool operator==(const TransposePlanKey& other) const {
+        return outer == other.outer && inner == other.inner && rows == other.rows && cols == other.cols &&
+               nnz == other.nnz && sample == other.sample && nb_threads == other.nb_threads;
+    }
+};
+
+// Plans of the most recently used matrices, so that repeated adjoint applications of the same matrix do not analyse
+// or transpose its sparsity pattern again
+std::shared_ptr<const TransposePlan> transpose_plan(const SparseMatrix& W, int nb_threads) {
+    constexpr size_t max_plans = 4;
+    using Entry                = std::pair<TransposePlanKey, std::shared_ptr<const TransposePlan>>;
+    static std::mutex mutex;
+    static std::list<Entry> plans;
+
+    TransposePlanKey key(W, nb_threads);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = plans.begin(); it != plans.end(); ++it) {
+            if (it->first == key) {
+                plans.splice(plans.begin(), plans, it);
+                return plans.front().second;
+            }
+        }
+    }
+
+    auto plan = std::make_shared<const TransposePlan>(W, nb_threads);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    plans.emplace_front(key, plan);
+    if (plans.size() > max_plans) {
+        plans.pop_back();
+    }
+    return plan;
+}
+
+// Per-thread accumulation buffers, taken from a pool and returned to it on destruction, so that their capacity is
+// reused by subsequent calls
+template <typename Value>
+class PartialSums {
+public:
+    PartialSums(int nb_threads) {
+        {
+            std::lock_guard<std::mutex> lock(mutex());
+            if (not pool().empty()) {
+                buffers_ = std::move(pool().back());
+                pool().pop_back();
+            }
+        }
+        buffers_.resize(nb_threads);
+    }
+
+    ~PartialSums() {
+        std::lock_guard<std::mutex> lock(mutex());
+        if (pool().size() < max_pooled) {
+            pool().emplace_back(std::move(buffers_));
+        }
+    }
+
+    std::vector<Value>& operator[](int thread) { return buffers_[thread]; }
+    const std::vector<Value>& operator[](int thread) const { return buffers_[thread]; }
+
+private:
+    static constexpr size_t max_pooled = 2;
+    static std::vector<std::vector<std::vector<Value>>>& pool() {
+        static std::vector<std::vector<std::vector<Value>>> pool_;
+        return pool_;
+    }
+    static std::mutex& mutex() {
+        static std::mutex mutex_;
+        return mutex_;
+    }
+
+    std::vector<std::vector<Value>> buffers_;
+};
+
+// tgt(n, k) += W(r, n) * src(r, k) for k in [0, Nk), with views accessed via given functors.
+//
+// See TransposePlan for how the work is split over threads. The buffers are added to the target per block of
+// columns, visiting the threads in order, so results are reproducible for a given number of threads.
+template <typename Value, typename SourceAccess, typename TargetAccess>
+void multiply_add_transpose(const SparseMatrix& W, idx_t Nk, const SourceAccess& src, const TargetAccess& tgt) {
+    const auto outer  = W.outer();
+    const auto index  = W.inner();
+    const auto weight = W.data();
+    const idx_t rows  = static_cast<idx_t>(W.rows());
+    const idx_t cols  = static_cast<idx_t>(W.cols());
+
+    const int max_threads = atlas_omp_get_max_threads();
+    if (max_threads == 1 || rows < 2 * max_threads) {
+        for (idx_t r = 0; r < rows; ++r) {
+            for (auto c = outer[r]; c < outer[r + 1]; ++c) {
+                const idx_t n = index[c];
+                const Value w = static_cast<Value>(weight[c]);
+                for (idx_t k = 0; k < Nk; ++k) {
+                    tgt(n, k) += w * src(r, k);
+                }
+            }
+        }
+        return;
+    }
+
+    const auto plan       = transpose_plan(W, max_threads);
+    const auto& row_begin = plan->row_begin;
+    const auto& col_begin = plan->col_begin;
+    const auto& col_end   = plan->col_end;
+
+    if (plan->use_buffers) {
+        PartialSums<Value> partial(max_threads);
+        atlas_omp_parallel_for(int thread = 0; thread < max_threads; ++thread) {
+            const idx_t n_begin = col_begin[thread];
+            auto& sum           = partial[thread];
+            sum.assign(size_t(col_end[thread] - n_begin) * Nk, Value(0));
+            for (idx_t r = row_begin[thread]; r < row_begin[thread + 1]; ++r) {
+                for (auto c = outer[r]; c < outer[r + 1]; ++c) {
+                    Value* sum_n  = sum.data() + size_t(index[c] - n_begin) * Nk;
+                    const Value w = static_cast<Value>(weight[c]);
+                    for (idx_t k = 0; k < Nk; ++k) {
+                        sum_n[k] += w * src(r, k);
+                    }
+                }
+            }
+        }
+
+        // Each block of columns only visits the overlapping part of each buffer
+        atlas_omp_parallel_for(int block = 0; block < max_threads; ++block) {
+            const idx_t b_begin = static_cast<idx_t>((size_t(cols) * block) / max_threads);
+            const idx_t b_end   = static_cast<idx_t>((size_t(cols) * (block + 1)) / max_threads);
+            for (int thread = 0; thread < max_threads; ++thread) {
+                const idx_t n_begin = std::max(b_begin, col_begin[thread]);
+                const idx_t n_end   = std::min(b_end, col_end[thread]);
+                for (idx_t n = n_begin; n < n_end; ++n) {
+                    const Value* sum_n = partial[thread].data() + size_t(n - col_begin[thread]) * Nk;
+                    for (idx_t k = 0; k < Nk; ++k) {
+                        tgt(n, k) += sum_n[k];
+                    }
+                }
+            }
+        }
+        return;
+    }
+
+    const auto& t_outer   = plan->t_outer;
+    const auto& t_row     = plan->t_row;
+    const auto& t_nonzero = plan->t_nonzero;
+    atlas_omp_parallel_for(idx_t n = 0; n < cols; ++n) {
+        for (size_t p = t_outer[n]; p < t_outer[n + 1]; ++p) {
+            const idx_t r = t_row[p];
+            const Value w = static_cast<Value>(weight[t_nonzero[p]]);
+            for (idx_t k = 0; k < Nk; ++k) {
+                tgt(n, k) += w * src(r, k);
+            }
+        }
+    }
+}
+
+}  // namespace
+
 template <typename SourceValue, typename TargetValue>
 void SparseMatrixMultiply<backend::openmp, Indexing::layout_left, 1, SourceValue, TargetValue>::apply(
     const SparseMatrix& W, const View<SourceValue, 1>& src, View<TargetValue, 1>& tgt, const Configuration&) {
@@ -175,13 +455,87 @@ void SparseMatrixMultiply<backend::openmp, Indexing::layout_right, 3, SourceValu
     }
 }
 
-#define EXPLICIT_TEMPLATE_INSTANTIATION(TYPE)                                                           \
-    template struct SparseMatrixMultiply<backend::openmp, Indexing::layout_left, 1, TYPE const, TYPE>;  \
-    template struct SparseMatrixMultiply<backend::openmp, Indexing::layout_left, 2, TYPE const, TYPE>;  \
-    template struct SparseMatrixMultiply<backend::openmp, Indexing::layout_left, 3, TYPE const, TYPE>;  \
-    template struct SparseMatrixMultiply<backend::openmp, Indexing::layout_right, 1, TYPE const, TYPE>; \
-    template struct SparseMatrixMultiply<backend::openmp, Indexing::layout_right, 2, TYPE const, TYPE>; \
-    template struct SparseMatrixMultiply<backend::openmp, Indexing::layout_right, 3, TYPE const, TYPE>;
+template <typename SourceValue, typename TargetValue>
+void SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_left, 1, SourceValue, TargetValue>::apply(
+    const SparseMatrix& W, const View<SourceValue, 1>& src, View<TargetValue, 1>& tgt, const Configuration&) {
+    ATLAS_ASSERT(src.shape(0) >= W.rows());
+    ATLAS_ASSERT(tgt.shape(0) >= W.cols());
+    multiply_add_transpose<TargetValue>(
+        W, 1, [&](idx_t r, idx_t) { return src[r]; }, [&](idx_t n, idx_t) -> TargetValue& { return tgt[n]; });
+}
+
+template <typename SourceValue, typename TargetValue>
+void SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_left, 2, SourceValue, TargetValue>::apply(
+    const SparseMatrix& W, const View<SourceValue, 2>& src, View<TargetValue, 2>& tgt, const Configuration&) {
+    ATLAS_ASSERT(src.shape(0) >= W.rows());
+    ATLAS_ASSERT(tgt.shape(0) >= W.cols());
+    ATLAS_ASSERT(src.shape(1) == tgt.shape(1));
+    multiply_add_transpose<TargetValue>(
+        W, src.shape(1), [&](idx_t r, idx_t k) { return src(r, k); },
+        [&](idx_t n, idx_t k) -> TargetValue& { return tgt(n, k); });
+}
+
+template <typename SourceValue, typename TargetValue>
+void SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_left, 3, SourceValue, TargetValue>::apply(
+    const SparseMatrix& W, const View<SourceValue, 3>& src, View<TargetValue, 3>& tgt, const Configuration& config) {
+    if (src.contiguous() && tgt.contiguous()) {
+        // We can take a more optimized route by reducing rank
+        auto src_v = View<SourceValue, 2>(src.data(), array::make_shape(src.shape(0), src.stride(0)));
+        auto tgt_v = View<TargetValue, 2>(tgt.data(), array::make_shape(tgt.shape(0), tgt.stride(0)));
+        SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_left, 2, SourceValue, TargetValue>::apply(
+            W, src_v, tgt_v, config);
+        return;
+    }
+    ATLAS_ASSERT(src.shape(0) >= W.rows());
+    ATLAS_ASSERT(tgt.shape(0) >= W.cols());
+    const idx_t Nl = src.shape(2);
+    multiply_add_transpose<TargetValue>(
+        W, src.shape(1) * Nl, [&](idx_t r, idx_t kl) { return src(r, kl / Nl, kl % Nl); },
+        [&](idx_t n, idx_t kl) -> TargetValue& { return tgt(n, kl / Nl, kl % Nl); });
+}
+
+template <typename SourceValue, typename TargetValue>
+void SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_right, 1, SourceValue, TargetValue>::apply(
+    const SparseMatrix& W, const View<SourceValue, 1>& src, View<TargetValue, 1>& tgt, const Configuration& config) {
+    return SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_left, 1, SourceValue,
+                                            TargetValue>::apply(W, src, tgt, config);
+}
+
+template <typename SourceValue, typename TargetValue>
+void SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_right, 2, SourceValue, TargetValue>::apply(
+    const SparseMatrix& W, const View<SourceValue, 2>& src, View<TargetValue, 2>& tgt, const Configuration&) {
+    ATLAS_ASSERT(src.shape(1) >= W.rows());
+    ATLAS_ASSERT(tgt.shape(1) >= W.cols());
+    ATLAS_ASSERT(src.shape(0) == tgt.shape(0));
+    multiply_add_transpose<TargetValue>(
+        W, src.shape(0), [&](idx_t r, idx_t k) { return src(k, r); },
+        [&](idx_t n, idx_t k) -> TargetValue& { return tgt(k, n); });
+}
+
+template <typename SourceValue, typename TargetValue>
+void SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_right, 3, SourceValue, TargetValue>::apply(
+    const SparseMatrix& W, const View<SourceValue, 3>& src, View<TargetValue, 3>& tgt, const Configuration&) {
+    ATLAS_ASSERT(src.shape(2) >= W.rows());
+    ATLAS_ASSERT(tgt.shape(2) >= W.cols());
+    const idx_t Nk = src.shape(1);
+    multiply_add_transpose<TargetValue>(
+        W, src.shape(0) * Nk, [&](idx_t r, idx_t lk) { return src(lk / Nk, lk % Nk, r); },
+        [&](idx_t n, idx_t lk) -> TargetValue& { return tgt(lk / Nk, lk % Nk, n); });
+}
+
+#define EXPLICIT_TEMPLATE_INSTANTIATION(TYPE)                                                                       \
+    template struct SparseMatrixMultiply<backend::openmp, Indexing::layout_left, 1, TYPE const, TYPE>;              \
+    template struct SparseMatrixMultiply<backend::openmp, Indexing::layout_left, 2, TYPE const, TYPE>;              \
+    template struct SparseMatrixMultiply<backend::openmp, Indexing::layout_left, 3, TYPE const, TYPE>;              \
+    template struct SparseMatrixMultiply<backend::openmp, Indexing::layout_right, 1, TYPE const, TYPE>;             \
+    template struct SparseMatrixMultiply<backend::openmp, Indexing::layout_right, 2, TYPE const, TYPE>;             \
+    template struct SparseMatrixMultiply<backend::openmp, Indexing::layout_right, 3, TYPE const, TYPE>;             \
+    template struct SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_left, 1, TYPE const, TYPE>;  \
+    template struct SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_left, 2, TYPE const, TYPE>;  \
+    template struct SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_left, 3, TYPE const, TYPE>;  \
+    template struct SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_right, 1, TYPE const, TYPE>; \
+    template struct SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_right, 2, TYPE const, TYPE>; \
+    template struct SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_right, 3, TYPE const, TYPE>;
 
 EXPLICIT_TEMPLATE_INSTANTIATION(double);
 EXPLICIT_TEMPLATE_INSTANTIATION(float);
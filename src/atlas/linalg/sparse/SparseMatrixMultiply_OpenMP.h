@@ -53,6 +53,42 @@ struct SparseMatrixMultiply<backend::openmp, Indexing::layout_right, 3, SourceVa
                       const Configuration&);
 };
 
+template <typename SourceValue, typename TargetValue>
+struct SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_left, 1, SourceValue, TargetValue> {
+    static void apply(const SparseMatrix& W, const View<SourceValue, 1>& src, View<TargetValue, 1>& tgt,
+                      const Configuration&);
+};
+
+template <typename SourceValue, typename TargetValue>
+struct SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_left, 2, SourceValue, TargetValue> {
+    static void apply(const SparseMatrix& W, const View<SourceValue, 2>& src, View<TargetValue, 2>& tgt,
+                      const Configuration&);
+};
+
+template <typename SourceValue, typename TargetValue>
+struct SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_left, 3, SourceValue, TargetValue> {
+    static void apply(const SparseMatrix& W, const View<SourceValue, 3>& src, View<TargetValue, 3>& tgt,
+                      const Configuration&);
+};
+
+template <typename SourceValue, typename TargetValue>
+struct SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_right, 1, SourceValue, TargetValue> {
+    static void apply(const SparseMatrix& W, const View<SourceValue, 1>& src, View<TargetValue, 1>& tgt,
+                      const Configuration&);
+};
+
+template <typename SourceValue, typename TargetValue>
+struct SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_right, 2, SourceValue, TargetValue> {
+    static void apply(const SparseMatrix& W, const View<SourceValue, 2>& src, View<TargetValue, 2>& tgt,
+                      const Configuration&);
+};
+
+template <typename SourceValue, typename TargetValue>
+struct SparseMatrixMultiplyAddTranspose<backend::openmp, Indexing::layout_right, 3, SourceValue, TargetValue> {
+    static void apply(const SparseMatrix& W, const View<SourceValue, 3>& src, View<TargetValue, 3>& tgt,
+                      const Configuration&);
+};
+
 }  // namespace sparse
 }  // namespace linalg
 }  // namespace atlas
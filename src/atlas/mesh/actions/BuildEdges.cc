@@ -34,6 +34,8 @@
 #include "atlas/mesh/Nodes.h"
 #include "atlas/mesh/detail/AccumulateFacets.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/parallel/omp/sort.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/util/CoordinateEnums.h"
@@ -63,6 +65,12 @@ struct Sort {
     idx_t i;
     bool operator<(const Sort& other) const { return (g < other.g); }
 };
+
+// Sort by uid, and keep the original order of equal uids like std::stable_sort
+void sort_edges_by_uid(std::vector<Sort>& edge_sort) {
+    omp::sort(edge_sort.begin(), edge_sort.end(),
+              [](const Sort& a, const Sort& b) { return a.g < b.g || (a.g == b.g && a.i < b.i); });
+}
 }  // anonymous namespace
 
 void build_element_to_edge_connectivity(Mesh& mesh) {
@@ -87,16 +95,15 @@ void build_element_to_edge_connectivity(Mesh& mesh) {
     auto is_pole_edge = [&](idx_t e) { return Topology::check(edge_flags(e), Topology::POLE); };
 
     // Sort edges for bit-reproducibility
-    std::vector<Sort> edge_sort;
-    edge_sort.reserve(nb_edges);
+    std::vector<Sort> edge_sort(nb_edges);
     {
         UniqueLonLat compute_uid(mesh);
 
-        for (idx_t jedge = 0; jedge < nb_edges; ++jedge) {
-            edge_sort.emplace_back(compute_uid(edge_node_connectivity.row(jedge)), jedge);
+        atlas_omp_parallel_for(idx_t jedge = 0; jedge < nb_edges; ++jedge) {
+            edge_sort[jedge] = Sort(compute_uid(edge_node_connectivity.row(jedge)), jedge);
         }
 
-        std::sort(edge_sort.data(), edge_sort.data() + nb_edges);
+        sort_edges_by_uid(edge_sort);
     }
 
     // Fill in cell_edge_connectivity
@@ -178,10 +185,10 @@ void build_node_to_edge_connectivity(Mesh& mesh) {
 
     UniqueLonLat compute_uid(mesh);
     std::vector<Sort> edge_sort(nb_edges);
-    for (idx_t jedge = 0; jedge < nb_edges; ++jedge) {
+    atlas_omp_parallel_for(idx_t jedge = 0; jedge < nb_edges; ++jedge) {
         edge_sort[jedge] = Sort(compute_uid(edge_node_connectivity.row(jedge)), jedge);
     }
-    std::stable_sort(edge_sort.data(), edge_sort.data() + nb_edges);
+    sort_edges_by_uid(edge_sort);
 
     for (idx_t jedge = 0; jedge < nb_edges; ++jedge) {
         idx_t iedge = edge_sort[jedge].i;
@@ -433,7 +440,14 @@ void build_edges(Mesh& mesh, const eckit::Configuration& config) {
         auto edge_flags   = array::make_view<int, 1>(mesh.edges().flags());
 
         ATLAS_ASSERT(cell_nodes.missing_value() == missing_value);
+        // Validate serially: exceptions must not escape the parallel loop below
         for (idx_t edge = edge_start; edge < edge_end; ++edge) {
+            const idx_t iedge = edge_halo_offsets[halo] + (edge - edge_start);
+            ATLAS_ASSERT(idx_t(edge_nodes(edge, 0)) < nb_nodes);
+            ATLAS_ASSERT(idx_t(edge_nodes(edge, 1)) < nb_nodes);
+            ATLAS_ASSERT(edge_to_elem_data[2 * iedge + 0] != cell_nodes.missing_value());
+        }
+        atlas_omp_parallel_for(idx_t edge = edge_start; edge < edge_end; ++edge) {
             const idx_t iedge = edge_halo_offsets[halo] + (edge - edge_start);
             const int ip1     = edge_nodes(edge, 0);
             const int ip2     = edge_nodes(edge, 1);
@@ -442,8 +456,6 @@ void build_edges(Mesh& mesh, const eckit::Configuration& config) {
                 edge_nodes.set(edge, swapped);
             }
 
-            ATLAS_ASSERT(idx_t(edge_nodes(edge, 0)) < nb_nodes);
-            ATLAS_ASSERT(idx_t(edge_nodes(edge, 1)) < nb_nodes);
             edge_glb_idx(edge) = compute_uid(edge_nodes.row(edge));
             edge_part(edge)    = std::min(node_part(edge_nodes(edge, 0)), node_part(edge_nodes(edge, 1)));
             edge_ridx(edge)    = edge;
@@ -453,7 +465,6 @@ void build_edges(Mesh& mesh, const eckit::Configuration& config) {
             const idx_t e1 = edge_to_elem_data[2 * iedge + 0];
             const idx_t e2 = edge_to_elem_data[2 * iedge + 1];
 
-            ATLAS_ASSERT(e1 != cell_nodes.missing_value());
             if (e2 == cell_nodes.missing_value()) {
                 // do nothing
             }
@@ -8,6 +8,7 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 #include <iostream>
@@ -62,15 +63,101 @@ namespace atlas {
 namespace mesh {
 namespace actions {
 
-struct Entity {
-    Entity(gidx_t gid, idx_t idx) {
-        g = gid;
-        i = idx;
+namespace {
+
+/// Replace each global index by its position among the distinct global indices of all partitions,
+/// numbered from glb_idx_max+1 upwards in increasing order. Equal global indices on different
+/// partitions receive the same new number.
+/// The distinct global indices are distributed over the partitions in sorted ranges chosen by
+/// regular sampling (sample sort), so that no partition holds more than its share of them.
+void renumber_global_index(std::vector<gidx_t>& glb_idx, gidx_t glb_idx_max) {
+    ATLAS_TRACE();
+    const auto& comm = mpi::comm();
+    const int nparts = static_cast<int>(comm.size());
+    const int mypart = static_cast<int>(comm.rank());
+
+    // 1) Sorted distinct local global indices
+    std::vector<gidx_t> local(glb_idx);
+    omp::sort(local.begin(), local.end());
+    local.erase(std::unique(local.begin(), local.end()), local.end());
+
+    // 2) Choose splitters from regular samples of every partition
+    std::vector<gidx_t> samples;
+    if (not local.empty()) {
+        samples.reserve(nparts - 1);
+        for (int k = 1; k < nparts; ++k) {
+            samples.emplace_back(local[(k * local.size()) / nparts]);
+        }
     }
-    gidx_t g;
-    idx_t i;
-    bool operator<(const Entity& other) const { return (g < other.g); }
-};
+    std::vector<int> sample_counts(nparts);
+    std::vector<int> sample_displs(nparts);
+    ATLAS_TRACE_MPI(ALLGATHER) {
+        comm.allGather(static_cast<int>(samples.size()), sample_counts.begin(), sample_counts.end());
+    }
+    std::partial_sum(sample_counts.begin(), sample_counts.end() - 1, sample_displs.begin() + 1);
+    std::vector<gidx_t> all_samples(sample_displs.back() + sample_counts.back());
+    ATLAS_TRACE_MPI(ALLGATHER) {
+        comm.allGatherv(samples.begin(), samples.end(), all_samples.begin(), sample_counts.data(),
+                        sample_displs.data());
+    }
+    std::sort(all_samples.begin(), all_samples.end());
+    std::vector<gidx_t> splitters;
+    if (not all_samples.empty()) {
+        splitters.reserve(nparts - 1);
+        for (int k = 1; k < nparts; ++k) {
+            splitters.emplace_back(all_samples[(k * all_samples.size()) / nparts]);
+        }
+    }
+    auto destination = [&](gidx_t g) {
+        return std::upper_bound(splitters.begin(), splitters.end(), g) - splitters.begin();
+    };
+
+    // 3) Send each distinct global index to the partition owning its range.
+    //    As "local" is sorted, concatenating the send buffers restores its order.
+    std::vector<std::vector<gidx_t>> send(nparts);
+    std::vector<std::vector<gidx_t>> recv(nparts);
+    for (gidx_t g : local) {
+        send[destination(g)].emplace_back(g);
+    }
+    ATLAS_TRACE_MPI(ALLTOALL) { comm.allToAll(send, recv); }
+
+    // 4) Number the distinct global indices in my range, offset by those in lower ranges
+    std::vector<gidx_t> owned;
+    for (const auto& r : recv) {
+        owned.insert(owned.end(), r.begin(), r.end());
+    }
+    omp::sort(owned.begin(), owned.end());
+    owned.erase(std::unique(owned.begin(), owned.end()), owned.end());
+
+    std::vector<gidx_t> nb_owned(nparts);
+    ATLAS_TRACE_MPI(ALLGATHER) {
+        comm.allGather(static_cast<gidx_t>(owned.size()), nb_owned.begin(), nb_owned.end());
+    }
+    const gidx_t offset = std::accumulate(nb_owned.begin(), nb_owned.begin() + mypart, glb_idx_max + 1);
+
+    for (auto& r : recv) {
+        for (auto& g : r) {
+            g = offset + (std::lower_bound(owned.begin(), owned.end(), g) - owned.begin());
+        }
+    }
+
+    // 5) Return the new numbers to the partitions that asked for them
+    ATLAS_TRACE_MPI(ALLTOALL) { comm.allToAll(recv, send); }
+
+    std::vector<gidx_t> renumbered;
+    renumbered.reserve(local.size());
+    for (const auto& s : send) {
+        renumbered.insert(renumbered.end(), s.begin(), s.end());
+    }
+    ATLAS_ASSERT(renumbered.size() == local.size());
+
+    const idx_t size = static_cast<idx_t>(glb_idx.size());
+    atlas_omp_parallel_for(idx_t i = 0; i < size; ++i) {
+        glb_idx[i] = renumbered[std::lower_bound(local.begin(), local.end(), glb_idx[i]) - local.begin()];
+    }
+}
+
+}  // namespace
 
 void make_nodes_global_index_human_readable(const mesh::actions::BuildHalo& build_halo, mesh::Nodes& nodes,
                                             bool do_all) {
@@ -80,16 +167,7 @@ void make_nodes_global_index_human_readable(const mesh::actions::BuildHalo& buil
     // uid,
     //     and could receive different gidx for different tasks
 
-    // unused // int mypart = mpi::rank();
-    int nparts  = mpi::size();
-    size_t root = 0;
-
     array::ArrayView<gidx_t, 1> nodes_glb_idx = array::make_view<gidx_t, 1>(nodes.global_index());
-    // nodes_glb_idx.dump( Log::info() );
-    //  ATLAS_DEBUG( "min = " << nodes.global_index().metadata().getLong("min") );
-    //  ATLAS_DEBUG( "max = " << nodes.global_index().metadata().getLong("max") );
-    //  ATLAS_DEBUG( "human_readable = " <<
-    //  nodes.global_index().metadata().getBool("human_readable") );
     gidx_t glb_idx_max = 0;
 
     std::vector<int> points_to_edit;
@@ -114,76 +192,18 @@ void make_nodes_global_index_human_readable(const mesh::actions::BuildHalo& buil
         glb_idx[i] = nodes_glb_idx(points_to_edit[i]);
     }
 
-    //  ATLAS_DEBUG_VAR( points_to_edit );
-    //  ATLAS_DEBUG_VAR( points_to_edit.size() );
-
     /*
  * Sorting following gidx will define global order of
  * gathered fields. Special care needs to be taken for
  * pole edges, as their centroid might coincide with
  * other edges
  */
-    // Try to recover
-    //  {
-    //    UniqueLonLat compute_uid(nodes);
-    //    for( int jnode=0; jnode<nb_nodes; ++jnode ) {
-    //      if( glb_idx(jnode) <= 0 ) {
-    //        glb_idx(jnode) = compute_uid(jnode);
-    //      }
-    //    }
-    //  }
-
-    // 1) Gather all global indices, together with location
-
-    std::vector<int> recvcounts(mpi::size());
-    std::vector<int> recvdispls(mpi::size());
-
-    ATLAS_TRACE_MPI(GATHER) { mpi::comm().gather(nb_nodes, recvcounts, root); }
-    idx_t glb_nb_nodes = std::accumulate(recvcounts.begin(), recvcounts.end(), 0);
-
-    recvdispls[0] = 0;
-    for (int jpart = 1; jpart < nparts; ++jpart) {  // start at 1
-        recvdispls[jpart] = recvcounts[jpart - 1] + recvdispls[jpart - 1];
-    }
-
-    std::vector<gidx_t> glb_idx_gathered(glb_nb_nodes);
-    ATLAS_TRACE_MPI(GATHER) {
-        mpi::comm().gatherv(glb_idx.data(), glb_idx.size(), glb_idx_gathered.data(), recvcounts.data(),
-                            recvdispls.data(), root);
-    }
-
-    // 2) Sort all global indices, and renumber from 1 to glb_nb_edges
-    std::vector<Entity> node_sort;
-    node_sort.reserve(glb_nb_nodes);
-    const idx_t nb_glb_idx_gathered = static_cast<idx_t>(glb_idx_gathered.size());
-    for (idx_t jnode = 0; jnode < nb_glb_idx_gathered; ++jnode) {
-        node_sort.emplace_back(glb_idx_gathered[jnode], jnode);
-    }
-
-    ATLAS_TRACE_SCOPE("sort on rank 0") { std::sort(node_sort.begin(), node_sort.end()); }
-
-    gidx_t gid               = glb_idx_max + 1;
-    const idx_t nb_node_sort = static_cast<idx_t>(node_sort.size());
-    for (idx_t jnode = 0; jnode < nb_node_sort; ++jnode) {
-        if (jnode > 0 && node_sort[jnode].g != node_sort[jnode - 1].g) {
-            ++gid;
-        }
-        int inode               = node_sort[jnode].i;
-        glb_idx_gathered[inode] = gid;
-    }
-
-    // 3) Scatter renumbered back
-    ATLAS_TRACE_MPI(SCATTER) {
-        mpi::comm().scatterv(glb_idx_gathered.data(), recvcounts.data(), recvdispls.data(), glb_idx.data(),
-                             static_cast<int>(glb_idx.size()), root);
-    }
+    renumber_global_index(glb_idx, glb_idx_max);
 
     for (int jnode = 0; jnode < nb_nodes; ++jnode) {
         nodes_glb_idx(points_to_edit[jnode]) = glb_idx[jnode];
     }
 
-    // nodes_glb_idx.dump( Log::info() );
-    // Log::info() << std::endl;
     nodes.global_index().metadata().set("human_readable", true);
 }
 
@@ -193,14 +213,7 @@ void make_cells_global_index_human_readable(const mesh::actions::BuildHalo& buil
                                             bool do_all) {
     ATLAS_TRACE();
 
-    int nparts = static_cast<idx_t>(mpi::size());
-    idx_t root = 0;
-
     array::ArrayView<gidx_t, 1> cells_glb_idx = array::make_view<gidx_t, 1>(cells.global_index());
-    //  ATLAS_DEBUG( "min = " << cells.global_index().metadata().getLong("min") );
-    //  ATLAS_DEBUG( "max = " << cells.global_index().metadata().getLong("max") );
-    //  ATLAS_DEBUG( "human_readable = " <<
-    //  cells.global_index().metadata().getBool("human_readable") );
     gidx_t glb_idx_max = 0;
 
     std::vector<int> cells_to_edit;
@@ -234,55 +247,12 @@ void make_cells_global_index_human_readable(const mesh::actions::BuildHalo& buil
         glb_idx[i] = cells_glb_idx(cells_to_edit[i]);
     }
 
-    // 1) Gather all global indices, together with location
-
-    std::vector<int> recvcounts(mpi::size());
-    std::vector<int> recvdispls(mpi::size());
-
-    ATLAS_TRACE_MPI(GATHER) { mpi::comm().gather(nb_cells, recvcounts, root); }
-    idx_t glb_nb_cells = std::accumulate(recvcounts.begin(), recvcounts.end(), 0);
-
-    recvdispls[0] = 0;
-    for (int jpart = 1; jpart < nparts; ++jpart) {  // start at 1
-        recvdispls[jpart] = recvcounts[jpart - 1] + recvdispls[jpart - 1];
-    }
-
-    std::vector<gidx_t> glb_idx_gathered(glb_nb_cells);
-    ATLAS_TRACE_MPI(GATHER) {
-        mpi::comm().gatherv(glb_idx.data(), glb_idx.size(), glb_idx_gathered.data(), recvcounts.data(),
-                            recvdispls.data(), root);
-    }
-
-    // 2) Sort all global indices, and renumber from 1 to glb_nb_edges
-    std::vector<Entity> cell_sort;
-    cell_sort.reserve(glb_nb_cells);
-    for (idx_t jcell = 0; jcell < glb_nb_cells; ++jcell) {
-        cell_sort.emplace_back(glb_idx_gathered[jcell], jcell);
-    }
-
-    ATLAS_TRACE_SCOPE("sort on rank 0") { std::sort(cell_sort.begin(), cell_sort.end()); }
-
-    gidx_t gid = glb_idx_max + 1;
-    for (idx_t jcell = 0; jcell < glb_nb_cells; ++jcell) {
-        if (jcell > 0 && cell_sort[jcell].g != cell_sort[jcell - 1].g) {
-            ++gid;
-        }
-        idx_t icell             = cell_sort[jcell].i;
-        glb_idx_gathered[icell] = gid;
-    }
-
-    // 3) Scatter renumbered back
-    ATLAS_TRACE_MPI(SCATTER) {
-        mpi::comm().scatterv(glb_idx_gathered.data(), recvcounts.data(), recvdispls.data(), glb_idx.data(),
-                             static_cast<int>(glb_idx.size()), root);
-    }
+    renumber_global_index(glb_idx, glb_idx_max);
 
     for (int jcell = 0; jcell < nb_cells; ++jcell) {
         cells_glb_idx(cells_to_edit[jcell]) = glb_idx[jcell];
     }
 
-    // nodes_glb_idx.dump( Log::info() );
-    // Log::info() << std::endl;
     cells.global_index().metadata().set("human_readable", true);
 }
 
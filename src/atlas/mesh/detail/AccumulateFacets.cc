@@ -9,9 +9,15 @@
  */
 
 #include "atlas/mesh/detail/AccumulateFacets.h"
+
+#include <array>
+#include <limits>
+
 #include "atlas/mesh/Elements.h"
 #include "atlas/mesh/HybridElements.h"
 #include "atlas/mesh/Nodes.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/parallel/omp/sort.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Trace.h"
 
@@ -265,14 +271,25 @@ void accumulate_facets_in_range(std::vector<array::Range>& range, const mesh::Hy
     }
 }
 
-void accumulate_facets_ordered_by_halo(const mesh::HybridElements& cells, const mesh::Nodes& nodes,
-                                       std::vector<idx_t>& facet_nodes_data,  // shape(nb_facets,nb_nodes_per_facet)
-                                       std::vector<idx_t>& connectivity_facet_to_elem, idx_t& nb_facets,
-                                       idx_t& nb_inner_facets, idx_t& missing_value, std::vector<idx_t>& halo_offsets) {
-    ATLAS_TRACE();
+namespace {
+
+std::vector<std::array<int, 2>> facet_node_numbering(const mesh::Elements& elements) {
+    if (elements.name() == "Pentagon") {
+        return {{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0}};
+    }
+    else if (elements.name() == "Quadrilateral") {
+        return {{0, 1}, {1, 2}, {2, 3}, {3, 0}};
+    }
+    else if (elements.name() == "Triangle") {
+        return {{0, 1}, {1, 2}, {2, 0}};
+    }
+    throw_Exception(elements.name() + " is not \"Pentagon\", \"Quadrilateral\", or \"Triangle\"", Here());
+}
 
+// Ranges of elements of each type for each halo, returns the largest halo
+int element_ranges_by_halo(const mesh::HybridElements& cells, std::vector<std::vector<array::Range>>& ranges) {
     static int MAXHALO = 50;
-    std::vector<std::vector<array::Range>> ranges(MAXHALO, std::vector<array::Range>(cells.nb_types()));
+    ranges.assign(MAXHALO, std::vector<array::Range>(cells.nb_types()));
 
     int maxhalo{0};
     for (idx_t t = 0; t < cells.nb_types(); ++t) {
@@ -296,8 +313,14 @@ void accumulate_facets_ordered_by_halo(const mesh::HybridElements& cells, const
         ranges[halo][t] = array::Range{begin, end};
         maxhalo         = std::max(halo, maxhalo);
     }
+    return maxhalo;
+}
 
-
+void accumulate_facets_in_halo_ranges(std::vector<std::vector<array::Range>>& ranges, int maxhalo,
+                                      const mesh::HybridElements& cells, const mesh::Nodes& nodes,
+                                      std::vector<idx_t>& facet_nodes_data,
+                                      std::vector<idx_t>& connectivity_facet_to_elem, idx_t& nb_facets,
+                                      idx_t& nb_inner_facets, idx_t& missing_value, std::vector<idx_t>& halo_offsets) {
     missing_value = -1;
     std::vector<std::vector<idx_t>> node_to_facet(nodes.size());
     for (auto& facets : node_to_facet) {
@@ -306,7 +329,6 @@ void accumulate_facets_ordered_by_halo(const mesh::HybridElements& cells, const
     nb_facets       = 0;
     nb_inner_facets = 0;
 
-
     halo_offsets = std::vector<idx_t>{0};
     for (int h = 0; h <= maxhalo; ++h) {
         accumulate_facets_in_range(ranges[h], cells, nodes, facet_nodes_data, connectivity_facet_to_elem, nb_facets,
@@ -315,6 +337,137 @@ void accumulate_facets_ordered_by_halo(const mesh::HybridElements& cells, const
     }
 }
 
+}  // namespace
+
+void accumulate_facets_ordered_by_halo_serial(const mesh::HybridElements& cells, const mesh::Nodes& nodes,
+                                              std::vector<idx_t>& facet_nodes_data,
+                                              std::vector<idx_t>& connectivity_facet_to_elem, idx_t& nb_facets,
+                                              idx_t& nb_inner_facets, idx_t& missing_value,
+                                              std::vector<idx_t>& halo_offsets) {
+    ATLAS_TRACE();
+    std::vector<std::vector<array::Range>> ranges;
+    int maxhalo = element_ranges_by_halo(cells, ranges);
+    accumulate_facets_in_halo_ranges(ranges, maxhalo, cells, nodes, facet_nodes_data, connectivity_facet_to_elem,
+                                     nb_facets, nb_inner_facets, missing_value, halo_offsets);
+}
+
+void accumulate_facets_ordered_by_halo(const mesh::HybridElements& cells, const mesh::Nodes& nodes,
+                                       std::vector<idx_t>& facet_nodes_data,  // shape(nb_facets,nb_nodes_per_facet)
+                                       std::vector<idx_t>& connectivity_facet_to_elem, idx_t& nb_facets,
+                                       idx_t& nb_inner_facets, idx_t& missing_value, std::vector<idx_t>& halo_offsets) {
+    ATLAS_TRACE();
+
+    std::vector<std::vector<array::Range>> ranges;
+    int maxhalo = element_ranges_by_halo(cells, ranges);
+
+
+    using Topology  = atlas::mesh::Nodes::Topology;
+    missing_value   = -1;
+    nb_facets       = 0;
+    nb_inner_facets = 0;
+    halo_offsets    = std::vector<idx_t>{0};
+
+    // Facets in the order in which they are visited: by halo, element type, element and facet within the element.
+    // A facet is numbered by its first visit, as with the node-to-facet search in accumulate_facets_in_range,
+    // but duplicates are found by sorting the node pairs, which is done in parallel.
+    std::vector<size_t> block_begin{0};
+    std::vector<std::vector<std::array<int, 2>>> numbering(cells.nb_types());
+    for (idx_t t = 0; t < cells.nb_types(); ++t) {
+        numbering[t] = facet_node_numbering(cells.elements(t));
+    }
+    for (int h = 0; h <= maxhalo; ++h) {
+        for (idx_t t = 0; t < cells.nb_types(); ++t) {
+            const size_t nb_elems = ranges[h][t].end() - ranges[h][t].start();
+            block_begin.emplace_back(block_begin.back() + nb_elems * numbering[t].size());
+        }
+    }
+    const size_t nb_visits = block_begin.back();
+    std::vector<std::array<idx_t, 2>> visit_nodes(nb_visits);
+    std::vector<idx_t> visit_elem(nb_visits);
+
+    for (int h = 0; h <= maxhalo; ++h) {
+        for (idx_t t = 0; t < cells.nb_types(); ++t) {
+            const mesh::Elements& elements            = cells.elements(t);
+            const mesh::BlockConnectivity& elem_nodes = elements.node_connectivity();
+            auto elem_flags                           = elements.view<int, 1>(elements.flags());
+            const auto& facets                        = numbering[t];
+            const idx_t nb_facets_in_elem             = static_cast<idx_t>(facets.size());
+            const idx_t e_start                       = ranges[h][t].start();
+            const idx_t e_end                         = ranges[h][t].end();
+            const size_t begin                        = block_begin[h * cells.nb_types() + t];
+            atlas_omp_parallel_for(idx_t e = e_start; e < e_end; ++e) {
+                const bool patch = Topology::check(elem_flags(e), Topology::PATCH);
+                for (idx_t f = 0; f < nb_facets_in_elem; ++f) {
+                    const size_t v    = begin + size_t(e - e_start) * nb_facets_in_elem + f;
+                    visit_nodes[v][0] = elem_nodes(e, facets[f][0]);
+                    visit_nodes[v][1] = elem_nodes(e, facets[f][1]);
+                    visit_elem[v]     = patch ? missing_value : elements.begin() + e;
+                }
+            }
+        }
+    }
+
+    std::vector<size_t> order;
+    order.reserve(nb_visits);
+    for (size_t v = 0; v < nb_visits; ++v) {
+        if (visit_elem[v] != missing_value) {
+            if (visit_nodes[v][0] == visit_nodes[v][1]) {
+                // A collapsed facet matches any facet of its node in accumulate_facets_in_range; keep that behaviour
+                accumulate_facets_in_halo_ranges(ranges, maxhalo, cells, nodes, facet_nodes_data,
+                                                 connectivity_facet_to_elem, nb_facets, nb_inner_facets,
+                                                 missing_value, halo_offsets);
+                return;
+            }
+            order.emplace_back(v);
+        }
+    }
+
+    auto key = [&visit_nodes](size_t v) {
+        const auto& n = visit_nodes[v];
+        return n[0] < n[1] ? std::make_pair(n[0], n[1]) : std::make_pair(n[1], n[0]);
+    };
+    ATLAS_TRACE_SCOPE("sort facets") {
+        omp::sort(order.begin(), order.end(), [&key](size_t a, size_t b) {
+            const auto key_a = key(a);
+            const auto key_b = key(b);
+            return key_a < key_b || (key_a == key_b && a < b);
+        });
+    }
+
+    // For the first visit of each facet, the last visit: its element becomes the second element of the facet
+    constexpr size_t not_first = std::numeric_limits<size_t>::max();
+    std::vector<size_t> last_visit(nb_visits, not_first);
+    for (size_t j = 0; j < order.size();) {
+        size_t k = j + 1;
+        while (k < order.size() && key(order[k]) == key(order[j])) {
+            ++k;
+        }
+        last_visit[order[j]] = order[k - 1];
+        nb_inner_facets += static_cast<idx_t>(k - j - 1);
+        j = k;
+    }
+
+    if (connectivity_facet_to_elem.size() == 0) {
+        connectivity_facet_to_elem.reserve(2 * order.size());
+    }
+    if (facet_nodes_data.size() == 0) {
+        facet_nodes_data.reserve(2 * order.size());
+    }
+    for (int h = 0; h <= maxhalo; ++h) {
+        for (size_t v = block_begin[h * cells.nb_types()]; v < block_begin[(h + 1) * cells.nb_types()]; ++v) {
+            if (last_visit[v] != not_first) {
+                connectivity_facet_to_elem.emplace_back(visit_elem[v]);
+                connectivity_facet_to_elem.emplace_back(last_visit[v] != v ? visit_elem[last_visit[v]]
+                                                                           : missing_value);
+                facet_nodes_data.emplace_back(visit_nodes[v][0]);
+                facet_nodes_data.emplace_back(visit_nodes[v][1]);
+                ++nb_facets;
+            }
+        }
+        halo_offsets.emplace_back(nb_facets);
+    }
+}
+
 
 }  // namespace detail
 }  // namespace mesh
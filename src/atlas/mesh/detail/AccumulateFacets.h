@@ -41,6 +41,14 @@ void accumulate_facets_ordered_by_halo(const mesh::HybridElements& cells, const
                                        std::vector<idx_t>& connectivity_facet_to_elem, idx_t& nb_facets,
                                        idx_t& nb_inner_facets, idx_t& missing_value, std::vector<idx_t>& halo_offsets);
 
+// Same result as accumulate_facets_ordered_by_halo, with a serial node-to-facet search instead of a parallel sort.
+// Used for meshes with collapsed facets, and as reference in tests.
+void accumulate_facets_ordered_by_halo_serial(const mesh::HybridElements& cells, const mesh::Nodes& nodes,
+                                              std::vector<idx_t>& facet_nodes_data,
+                                              std::vector<idx_t>& connectivity_facet_to_elem, idx_t& nb_facets,
+                                              idx_t& nb_inner_facets, idx_t& missing_value,
+                                              std::vector<idx_t>& halo_offsets);
+
 }  // namespace detail
 }  // namespace mesh
 }  // namespace atlas
@@ -35,6 +35,7 @@
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
 #include "atlas/util/CoordinateEnums.h"
 #include "atlas/util/Topology.h"
 
@@ -62,6 +63,9 @@ HealpixMeshGenerator::HealpixMeshGenerator(const eckit::Parametrisation& p) {
     if (p.get("part", part)) {
         options.set("part", part);
     }
+    else {
+        part_is_mpi_rank_ = true;
+    }
 
     bool three_dimensional;
     if (p.get("3d", three_dimensional)) {
@@ -574,21 +578,10 @@ void HealpixMeshGenerator::generate_mesh(const StructuredGrid& grid, const grid:
         return ((latid == 0) or (latid == ny - 1) ? nb_pole_nodes : grid.nx()[latid - 1]);
     };
 
-    int ii, ix, iy, ii_ghost, ii_glb;
+    int ii, ix, iy, ii_ghost;
     int iy_min, iy_max;   // a belt (iy_min:iy_max) surrounding the nodes on this processor
     int nnodes_nonghost;  // non-ghost node: belongs to this part
 
-    // vector of local indices: necessary for remote indices of ghost nodes
-    std::vector<int> local_idx(nvertices, -1);
-    std::vector<int> current_idx(nparts, 0);  // index counter for each proc
-
-    // ANSATZ: requirement on the partitioner
-    auto compute_part = [&](int iy, gidx_t ii_glb) -> int {
-        // nodes at the pole belong to proc_0 (north) and proc_maxRank (south)
-        // a node gets its proc rank from the element for which this node would be its west vertex
-        return (iy == 0 ? 0 : (iy == ny - 1 ? nparts - 1 : distribution.partition(ii_glb - nb_pole_nodes)));
-    };
-
 #if DEBUG_OUTPUT_DETAIL
     for (iy = 0; iy < ny; iy++) {
         int nx = nb_lat_nodes(iy);
@@ -602,35 +595,57 @@ void HealpixMeshGenerator::generate_mesh(const StructuredGrid& grid, const grid:
     }
 #endif
 
-    // loop over all points to determine local indices and surrounding rectangle
-    ii_glb          = 0;  // global index starting from 0
-    iy_min          = ny + 1;
-    iy_max          = 0;
-    nnodes_nonghost = 0;
-    for (iy = 0; iy < ny; iy++) {
-        int nx = nb_lat_nodes(iy);
-        for (ix = 0; ix < nx; ix++) {
-            int proc_id       = compute_part(iy, ii_glb);
-            local_idx[ii_glb] = current_idx[proc_id]++;
-            if (proc_id == mypart) {
-                ++nnodes_nonghost;
-                iy_min = std::min(iy_min, iy);
-                iy_max = std::max(iy_max, iy);
+    // ANSATZ: requirement on the partitioner
+    // nodes at the pole belong to proc_0 (north) and proc_maxRank (south)
+    // a node gets its proc rank from the element for which this node would be its west vertex
+    // row_parts holds the partitions of the nodes in row iy, excluding the periodic node
+    std::vector<int> row_parts;
+    auto compute_row_parts = [&](int iy) {
+        row_parts.resize(nb_lat_nodes(iy));
+        if (iy == 0 or iy == ny - 1) {
+            std::fill(row_parts.begin(), row_parts.end(), iy == 0 ? 0 : nparts - 1);
+        }
+        else {
+            const gidx_t begin = idx_xy_to_x(0, iy, ns) - nb_pole_nodes;
+            distribution.partition(begin, begin + static_cast<gidx_t>(row_parts.size()), row_parts);
+        }
+    };
+
+    // Determine the rows (iy_min:iy_max) containing the nodes of this partition.
+    // When each partition is generated by its own MPI task, every task scans only its share of the rows
+    // and the row ranges of all partitions are combined with allReduce, so that no task touches all nodes.
+    // This decision only depends on the configuration, which is the same on all tasks, so that either all
+    // tasks or none enter the collective. With an explicitly configured "part", a task may generate a
+    // partition on its own, and all rows are scanned locally.
+    nnodes_nonghost = distribution.nb_pts()[mypart] + (mypart == 0 ? nb_pole_nodes : 0) +
+                      (mypart == nparts - 1 ? nb_pole_nodes : 0);
+    {
+        ATLAS_TRACE("rows of partition");
+        const auto& comm       = mpi::comm(options.getString("mpi_comm"));
+        const bool distributed = part_is_mpi_rank_ && nparts > 1 && static_cast<int>(comm.size()) == nparts;
+        const int nb_slices = distributed ? nparts : 1;
+        const int slice     = distributed ? mypart : 0;
+
+        std::vector<int> row_min(nparts, ny + 1);
+        std::vector<int> row_max(nparts, 0);
+        for (iy = (slice * ny) / nb_slices; iy < ((slice + 1) * ny) / nb_slices; iy++) {
+            compute_row_parts(iy);
+            for (int p : row_parts) {
+                row_min[p] = std::min(row_min[p], iy);
+                row_max[p] = std::max(row_max[p], iy);
             }
-            ++ii_glb;
         }
+        if (distributed) {
+            ATLAS_TRACE_MPI(ALLREDUCE) {
+                comm.allReduceInPlace(row_min.begin(), row_min.end(), eckit::mpi::min());
+                comm.allReduceInPlace(row_max.begin(), row_max.end(), eckit::mpi::max());
+            }
+        }
+        iy_min = row_min[mypart];
+        iy_max = row_max[mypart];
     }
 
 #if DEBUG_OUTPUT_DETAIL
-    inode = 0;
-    Log::info() << "local_idx : " << std::endl;
-    for (size_t ilat = 0; ilat < ny; ilat++) {
-        for (size_t ilon = 0; ilon < nb_lat_nodes(ilat); ilon++) {
-            Log::info() << std::setw(4) << local_idx[inode];
-            inode++;
-        }
-        Log::info() << std::endl;
-    }
     inode = 0;
     Log::info() << "global_idx : " << std::endl;
     for (size_t ilat = 0; ilat < ny; ilat++) {
@@ -677,16 +692,16 @@ void HealpixMeshGenerator::generate_mesh(const StructuredGrid& grid, const grid:
     ii_ghost = nnodes_SB - (iy_max - iy_min + 1);  // first local ghost idx
     for (iy = iy_min; iy <= iy_max; iy++) {
         int nx = nb_lat_nodes(iy) + 1;
+        compute_row_parts(iy);
         for (ix = 0; ix < nx; ix++) {
             if (ix != nx - 1) {
-                ii_glb           = ii + parts_sidx;
-                parts_SB[ii]     = compute_part(iy, ii_glb);
+                parts_SB[ii]     = row_parts[ix];
                 local_idx_SB[ii] = ii;
                 is_ghost_SB[ii]  = !(parts_SB[ii] == mypart);
                 ++ii;
             }
             else {
-                parts_SB[ii_ghost]     = compute_part(iy, ii_glb);
+                parts_SB[ii_ghost]     = row_parts[ix - 1];
                 local_idx_SB[ii_ghost] = ii_ghost;
                 is_ghost_SB[ii_ghost]  = true;
                 ++ii_ghost;
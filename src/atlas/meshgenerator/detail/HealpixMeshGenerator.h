@@ -67,6 +67,9 @@ private:
 
 private:
     util::Metadata options;
+    // True if "part" is not configured, so that it defaults to the MPI rank on every task of the communicator.
+    // Only then all tasks generate their own partition together and can take part in collective communication.
+    bool part_is_mpi_rank_{false};
     mutable gidx_t nb_points_;
     mutable gidx_t nb_nodes_;
     mutable int nb_pole_nodes_;
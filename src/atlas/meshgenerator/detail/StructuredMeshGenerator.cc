@@ -8,14 +8,16 @@
  * nor does it submit to any jurisdiction.
  */
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <iomanip>
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <sstream>
+#include <string>
 #include <vector>
 
-#include "eckit/log/ProgressTimer.h"
 #include "eckit/types/FloatCompare.h"
 #include "eckit/utils/Hash.h"
 
@@ -35,6 +37,7 @@
 #include "atlas/meshgenerator/detail/MeshGeneratorFactory.h"
 #include "atlas/meshgenerator/detail/StructuredMeshGenerator.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
 #include "atlas/util/CoordinateEnums.h"
@@ -396,7 +399,6 @@ We need to connect to next region
 
     region.elems.reset(array::Array::create<int>(shape));
 
-    int nelems     = 0;
     region.nquads  = 0;
     region.ntriags = 0;
 
@@ -404,13 +406,17 @@ We need to connect to next region
     elemview.assign(-1);
 
     ATLAS_TRACE_SCOPE("generate elements") {
-        eckit::Channel blackhole;
-
-        eckit::ProgressTimer progress("Generating elements for " + std::to_string(lat_south - lat_north) + " rows",
-                                      lat_south - lat_north, " row", 5.,
-                                      lat_south - lat_north > 1280 ? Log::trace() : blackhole);
-
-        for (idx_t jlat = lat_north; jlat < lat_south; ++jlat, ++progress) {
+        // Pairs of latitudes are stitched independently, in parallel. Each pair records its element counts
+        // and its bounds {beginN, endN, beginS, endS} on the northern and southern latitude, which are
+        // combined in latitude order afterwards, so that the result does not depend on the number of threads.
+        // Exceptions must not escape the parallel loop: a failing pair records its error, which is thrown after.
+        const idx_t nb_pairs = lat_south - lat_north;
+        std::vector<std::array<idx_t, 4>> pair_bounds(nb_pairs, std::array<idx_t, 4>{-1, -1, -1, -1});
+        std::vector<int> pair_nquads(nb_pairs, 0);
+        std::vector<int> pair_ntriags(nb_pairs, 0);
+        std::vector<std::string> pair_error(nb_pairs);
+
+        atlas_omp_parallel_for(idx_t jlat = lat_north; jlat < lat_south; ++jlat) {
             //    std::stringstream filename; filename << "/tmp/debug/"<<jlat;
 
             idx_t ilat, latN, latS;
@@ -422,6 +428,11 @@ We need to connect to next region
 
             ilat = jlat - region.north;
 
+            idx_t& lat_beginN = pair_bounds[ilat][0];
+            idx_t& lat_endN   = pair_bounds[ilat][1];
+            idx_t& lat_beginS = pair_bounds[ilat][2];
+            idx_t& lat_endS   = pair_bounds[ilat][3];
+
             auto lat_elems_view = elemview.slice(ilat, Range::all(), Range::all());
 
             latN = jlat;
@@ -566,7 +577,8 @@ We need to connect to next region
                                 }
                             }
                             else {
-                                throw_Exception("Should not be here", Here());
+                                pair_error[ilat] = "Should not be here";
+                                break;
                             }
                         }
                     }
@@ -604,17 +616,21 @@ We need to connect to next region
                             try_make_triangle_down = true;
                         }
                         else {
-                            ATLAS_DEBUG_VAR(dN1S2);
-                            ATLAS_DEBUG_VAR(dS1N2);
-                            ATLAS_DEBUG_VAR(jlat);
-                            Log::info() << ipN1 << "(" << xN1 << ")  " << ipN2 << "(" << xN2 << ")  " << std::endl;
-                            Log::info() << ipS1 << "(" << xS1 << ")  " << ipS2 << "(" << xS2 << ")  " << std::endl;
-                            throw_Exception("Should not try to make a quadrilateral!", Here());
+                            std::stringstream msg;
+                            msg << "Should not try to make a quadrilateral! jlat = " << jlat << ", dN1S2 = " << dN1S2
+                                << ", dS1N2 = " << dS1N2 << ", " << ipN1 << "(" << xN1 << ") " << ipN2 << "(" << xN2
+                                << ") " << ipS1 << "(" << xS1 << ") " << ipS2 << "(" << xS2 << ")";
+                            pair_error[ilat] = msg.str();
+                            break;
                         }
                     }
                 }
 
-                ATLAS_ASSERT( (ipN1!=ipN2) || (ipS1 != ipS2) );
+                if (ipN1 == ipN2 && ipS1 == ipS2) {
+                    pair_error[ilat] = "Assertion failed: (ipN1!=ipN2) || (ipS1 != ipS2), with jlat = " +
+                                       std::to_string(jlat);
+                    break;
+                }
                 if( ipN1 == ipN2 ) {
                     try_make_triangle_up = true;
                     try_make_triangle_down = false;
@@ -678,20 +694,19 @@ We need to connect to next region
                     }
                     add_quad = (pE == mypart);
                     if (add_quad) {
-                        ++region.nquads;
+                        ++pair_nquads[ilat];
                         ++jelem;
-                        ++nelems;
 
-                        if (region.lat_begin.at(latN) == -1) {
-                            region.lat_begin.at(latN) = ipN1;
+                        if (lat_beginN == -1) {
+                            lat_beginN = ipN1;
                         }
-                        if (region.lat_begin.at(latS) == -1) {
-                            region.lat_begin.at(latS) = ipS1;
+                        if (lat_beginS == -1) {
+                            lat_beginS = ipS1;
                         }
-                        region.lat_begin.at(latN) = std::min<int>(region.lat_begin.at(latN), ipN1);
-                        region.lat_begin.at(latS) = std::min<int>(region.lat_begin.at(latS), ipS1);
-                        region.lat_end.at(latN)   = std::max<int>(region.lat_end.at(latN), ipN2);
-                        region.lat_end.at(latS)   = std::max<int>(region.lat_end.at(latS), ipS2);
+                        lat_beginN = std::min<int>(lat_beginN, ipN1);
+                        lat_beginS = std::min<int>(lat_beginS, ipS1);
+                        lat_endN   = std::max<int>(lat_endN, ipN2);
+                        lat_endS   = std::max<int>(lat_endS, ipS2);
                     }
                     else {
 #if DEBUG_OUTPUT
@@ -720,21 +735,24 @@ We need to connect to next region
                     add_triag = (mypart == pE);
 
                     if (add_triag) {
-                        ATLAS_ASSERT(ipN1 != ipN2, "Faulty triangle with latN = "+std::to_string(latN)+"("+std::to_string(rg.y(latN))+")");
-                        ++region.ntriags;
+                        if (ipN1 == ipN2) {
+                            pair_error[ilat] = "Faulty triangle with latN = " + std::to_string(latN) + "(" +
+                                               std::to_string(rg.y(latN)) + ")";
+                            break;
+                        }
+                        ++pair_ntriags[ilat];
                         ++jelem;
-                        ++nelems;
 
-                        if (region.lat_begin.at(latN) == -1) {
-                            region.lat_begin.at(latN) = ipN1;
+                        if (lat_beginN == -1) {
+                            lat_beginN = ipN1;
                         }
-                        if (region.lat_begin.at(latS) == -1) {
-                            region.lat_begin.at(latS) = ipS1;
+                        if (lat_beginS == -1) {
+                            lat_beginS = ipS1;
                         }
-                        region.lat_begin.at(latN) = std::min<int>(region.lat_begin.at(latN), ipN1);
-                        region.lat_begin.at(latS) = std::min<int>(region.lat_begin.at(latS), ipS1);
-                        region.lat_end.at(latN)   = std::max<int>(region.lat_end.at(latN), ipN2);
-                        region.lat_end.at(latS)   = std::max<int>(region.lat_end.at(latS), ipS1);
+                        lat_beginN = std::min<int>(lat_beginN, ipN1);
+                        lat_beginS = std::min<int>(lat_beginS, ipS1);
+                        lat_endN   = std::max<int>(lat_endN, ipN2);
+                        lat_endS   = std::max<int>(lat_endS, ipS1);
                     }
                     else {
 #if DEBUG_OUTPUT
@@ -775,20 +793,19 @@ We need to connect to next region
                     add_triag = (mypart == pE);
 
                     if (add_triag) {
-                        ++region.ntriags;
+                        ++pair_ntriags[ilat];
                         ++jelem;
-                        ++nelems;
 
-                        if (region.lat_begin.at(latN) == -1) {
-                            region.lat_begin.at(latN) = ipN1;
+                        if (lat_beginN == -1) {
+                            lat_beginN = ipN1;
                         }
-                        if (region.lat_begin.at(latS) == -1) {
-                            region.lat_begin.at(latS) = ipS1;
+                        if (lat_beginS == -1) {
+                            lat_beginS = ipS1;
                         }
-                        region.lat_begin.at(latN) = std::min(region.lat_begin.at(latN), ipN1);
-                        region.lat_begin.at(latS) = std::min(region.lat_begin.at(latS), ipS1);
-                        region.lat_end.at(latN)   = std::max(region.lat_end.at(latN), ipN1);
-                        region.lat_end.at(latS)   = std::max(region.lat_end.at(latS), ipS2);
+                        lat_beginN = std::min(lat_beginN, ipN1);
+                        lat_beginS = std::min(lat_beginS, ipS1);
+                        lat_endN   = std::max(lat_endN, ipN1);
+                        lat_endS   = std::max(lat_endS, ipS2);
                     }
                     else {
 #if DEBUG_OUTPUT
@@ -799,7 +816,8 @@ We need to connect to next region
                     // and ipN1=ipN1;
                 }
                 else {
-                    throw_Exception("Could not detect which element to create", Here());
+                    pair_error[ilat] = "Could not detect which element to create";
+                    break;
                 }
                 ipN2 = std::min(endN, ipN1 + 1);
                 ipS2 = std::min(endS, ipS1 + 1);
@@ -808,6 +826,34 @@ We need to connect to next region
 #if DEBUG_OUTPUT
             ATLAS_DEBUG_VAR(region.nb_lat_elems.at(jlat));
 #endif
+        }  // for jlat
+
+        for (idx_t ilat = 0; ilat < nb_pairs; ++ilat) {
+            if (not pair_error[ilat].empty()) {
+                throw_Exception(pair_error[ilat], Here());
+            }
+        }
+
+        for (idx_t jlat = lat_north; jlat < lat_south; ++jlat) {
+            const idx_t ilat = jlat - lat_north;
+            const idx_t latN = jlat;
+            const idx_t latS = jlat + 1;
+            const double yN  = rg.y(latN);
+            const double yS  = rg.y(latS);
+
+            region.nquads += pair_nquads[ilat];
+            region.ntriags += pair_ntriags[ilat];
+
+            auto merge_bounds = [&](idx_t lat, idx_t begin, idx_t end) {
+                if (begin != -1) {
+                    region.lat_begin.at(lat) =
+                        (region.lat_begin.at(lat) == -1) ? begin : std::min(region.lat_begin.at(lat), begin);
+                }
+                region.lat_end.at(lat) = std::max(region.lat_end.at(lat), end);
+            };
+            merge_bounds(latN, pair_bounds[ilat][0], pair_bounds[ilat][1]);
+            merge_bounds(latS, pair_bounds[ilat][2], pair_bounds[ilat][3]);
+
             if (region.nb_lat_elems.at(jlat) == 0 && latN == region.north) {
                 ++region.north;
             }
@@ -829,7 +875,16 @@ We need to connect to next region
                 region.lat_end.at(latN) = std::max(region.lat_end.at(latN), region.lat_begin.at(latN));
                 region.lat_end.at(latS) = std::max(region.lat_end.at(latS), region.lat_begin.at(latS));
             }
-        }  // for jlat
+        }
+
+        // Rows of elements are accessed relative to region.north, which skipped leading rows without elements
+        for (idx_t jlat = region.north; jlat < lat_south && region.north != lat_north; ++jlat) {
+            for (idx_t jelem = 0; jelem < region.nb_lat_elems.at(jlat); ++jelem) {
+                for (idx_t jnode = 0; jnode < 4; ++jnode) {
+                    elemview(jlat - region.north, jelem, jnode) = elemview(jlat - lat_north, jelem, jnode);
+                }
+            }
+        }
     }
 
     //  Log::info()  << "nb_triags = " << region.ntriags << std::endl;
@@ -1096,18 +1151,26 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
         }
     }
 
-    idx_t jnode = 0;
-    l           = 0;
+    // Offsets of the nodes of each latitude, so that latitudes can be filled in parallel
+    l = 0;
     for (idx_t jlat = region.north; jlat <= region.south; ++jlat) {
         idx_t ilat          = jlat - region.north;
         offset_loc.at(ilat) = l;
         l += region.lat_end.at(jlat) - region.lat_begin.at(jlat) + 1;
+        if (not include_periodic_ghost_points) {
+            l -= std::max<idx_t>(0, region.lat_end.at(jlat) - std::max(region.lat_begin.at(jlat), rg.nx(jlat)) + 1);
+        }
+    }
+
+    atlas_omp_parallel_for(idx_t jlat = region.north; jlat <= region.south; ++jlat) {
+        idx_t ilat  = jlat - region.north;
+        idx_t jnode = offset_loc.at(ilat);
 
         double y = rg.y(jlat);
         for (idx_t jlon = region.lat_begin.at(jlat); jlon <= region.lat_end.at(jlat); ++jlon) {
             if (jlon < rg.nx(jlat)) {
                 idx_t inode = node_numbering.at(jnode);
-                n           = offset_glb.at(jlat) + jlon;
+                const int n = offset_glb.at(jlat) + jlon;
 
                 double x = rg.x(jlon, jlat);
                 // std::cout << "jlat = " << jlat << "; jlon = " << jlon << "; x = " <<
@@ -1195,11 +1258,9 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
                 }
                 ++jnode;
             }
-            else {
-                --l;
-            }
         }
     }
+    idx_t jnode = l;
 
     if (include_north_pole) {
         idx_t inode   = node_numbering.at(jnode);
@@ -1274,13 +1335,10 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
     /*
      * Fill in connectivity tables with global node indices first
      */
-    idx_t jcell;
     idx_t jquad       = 0;
     idx_t jtriag      = 0;
     idx_t quad_begin  = mesh.cells().elements(0).begin();
     idx_t triag_begin = mesh.cells().elements(1).begin();
-    idx_t quad_nodes[4];
-    idx_t triag_nodes[3];
 
     auto fix_quad_orientation = [](idx_t nodes[]) {
         idx_t tmp;
@@ -1304,14 +1362,39 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
     }
 
     if ((region.nquads + region.ntriags) > 0) {
-    for (idx_t jlat = region.north; jlat < region.south; ++jlat) {
+    const auto elems = array::make_view<int, 3>(*region.elems);
+
+    // Count quadrilaterals and triangles per latitude; their prefix sums give the first cell of each latitude,
+    // so that latitudes can be filled in parallel with the same cell numbering as a serial fill.
+    const idx_t nb_elem_lats = region.south - region.north;
+    std::vector<idx_t> lat_quad_begin(nb_elem_lats + 1, 0);
+    std::vector<idx_t> lat_triag_begin(nb_elem_lats + 1, 0);
+    atlas_omp_parallel_for(idx_t ilat = 0; ilat < nb_elem_lats; ++ilat) {
+        idx_t nb_quads = 0;
+        for (idx_t jelem = 0; jelem < region.nb_lat_elems.at(region.north + ilat); ++jelem) {
+            if (elems(ilat, jelem, 2) >= 0 && elems(ilat, jelem, 3) >= 0) {
+                ++nb_quads;
+            }
+        }
+        lat_quad_begin[ilat + 1]  = nb_quads;
+        lat_triag_begin[ilat + 1] = region.nb_lat_elems.at(region.north + ilat) - nb_quads;
+    }
+    std::partial_sum(lat_quad_begin.begin(), lat_quad_begin.end(), lat_quad_begin.begin());
+    std::partial_sum(lat_triag_begin.begin(), lat_triag_begin.end(), lat_triag_begin.begin());
+
+    atlas_omp_parallel_for(idx_t jlat = region.north; jlat < region.south; ++jlat) {
         idx_t ilat  = jlat - region.north;
         idx_t jlatN = jlat;
         idx_t jlatS = jlat + 1;
         idx_t ilatN = ilat;
         idx_t ilatS = ilat + 1;
+        idx_t jquad_lat  = lat_quad_begin[ilat];
+        idx_t jtriag_lat = lat_triag_begin[ilat];
+        idx_t jcell;
+        idx_t quad_nodes[4];
+        idx_t triag_nodes[3];
         for (idx_t jelem = 0; jelem < region.nb_lat_elems.at(jlat); ++jelem) {
-            const auto elem = array::make_view<int, 3>(*region.elems).slice(ilat, jelem, Range::all());
+            const auto elem = elems.slice(ilat, jelem, Range::all());
 
             if (elem(2) >= 0 && elem(3) >= 0)  // This is a quad
             {
@@ -1333,7 +1416,7 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
                     fix_quad_orientation(quad_nodes);
                 }
 
-                jcell = quad_begin + jquad++;
+                jcell = quad_begin + jquad_lat++;
                 node_connectivity.set(jcell, quad_nodes);
                 cells_glb_idx(jcell) = jcell + 1;
                 cells_part(jcell)    = mypart;
@@ -1381,13 +1464,19 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
                         fix_triag_orientation(triag_nodes);
                     }
                 }
-                jcell = triag_begin + jtriag++;
+                jcell = triag_begin + jtriag_lat++;
                 node_connectivity.set(jcell, triag_nodes);
                 cells_glb_idx(jcell) = jcell + 1;
                 cells_part(jcell)    = mypart;
             }
         }
     }
+    jquad  = lat_quad_begin.back();
+    jtriag = lat_triag_begin.back();
+
+    idx_t jcell;
+    idx_t quad_nodes[4];
+    idx_t triag_nodes[3];
 
     if (include_north_pole) {
         idx_t ilat = 0;
@@ -16,6 +16,8 @@
 #include "eckit/thread/AutoLock.h"
 #include "eckit/thread/Mutex.h"
 
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
 #include "atlas/library/config.h"
 #include "atlas/numerics/Method.h"
 #include "atlas/numerics/Nabla.h"
@@ -44,6 +46,13 @@ NablaImpl::NablaImpl(const Method& method, const eckit::Parametrisation&): metho
 
 NablaImpl::~NablaImpl() = default;
 
+void NablaImpl::gradient(const FieldSet& scalars, FieldSet& grads) const {
+    ATLAS_ASSERT(scalars.size() == grads.size());
+    for (idx_t jfield = 0; jfield < scalars.size(); ++jfield) {
+        gradient(scalars[jfield], grads[jfield]);
+    }
+}
+
 Nabla::Nabla(const Method& method, const eckit::Parametrisation& p): Handle(NablaFactory::build(method, p)) {}
 
 Nabla::Nabla(const Method& method): Nabla(method, util::NoConfig()) {}
@@ -52,6 +61,10 @@ void Nabla::gradient(const Field& scalar, Field& grad) const {
     get()->gradient(scalar, grad);
 }
 
+void Nabla::gradient(const FieldSet& scalars, FieldSet& grads) const {
+    get()->gradient(scalars, grads);
+}
+
 void Nabla::divergence(const Field& vector, Field& div) const {
     get()->divergence(vector, div);
 }
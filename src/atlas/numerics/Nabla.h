@@ -33,6 +33,7 @@ class FunctionSpaceImpl;
 }  // namespace atlas
 namespace atlas {
 class Field;
+class FieldSet;
 class FunctionSpace;
 }  // namespace atlas
 
@@ -46,6 +47,7 @@ public:
     virtual ~NablaImpl();
 
     virtual void gradient(const Field& scalar, Field& grad) const       = 0;
+    virtual void gradient(const FieldSet& scalars, FieldSet& grads) const;
     virtual void divergence(const Field& vector, Field& div) const      = 0;
     virtual void curl(const Field& vector, Field& curl) const           = 0;
     virtual void laplacian(const Field& scalar, Field& laplacian) const = 0;
@@ -67,6 +69,12 @@ public:
     Nabla(const Method&, const eckit::Parametrisation&);
 
     void gradient(const Field& scalar, Field& grad) const;
+
+    /// @brief Compute the gradients of all fields in scalars, pairwise into grads
+    ///
+    /// Implementations may compute all gradients in a single sweep over the mesh.
+    void gradient(const FieldSet& scalars, FieldSet& grads) const;
+
     void divergence(const Field& vector, Field& div) const;
     void curl(const Field& vector, Field& curl) const;
     void laplacian(const Field& scalar, Field& laplacian) const;
@@ -8,11 +8,16 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
+#include <map>
+#include <utility>
+
 #include "eckit/config/Parametrisation.h"
 
 #include "atlas/array/ArrayView.h"
 #include "atlas/array/MakeView.h"
 #include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
 #include "atlas/mesh/HybridElements.h"
 #include "atlas/mesh/Mesh.h"
 #include "atlas/mesh/Nodes.h"
@@ -56,6 +61,12 @@ Nabla::Nabla(const numerics::Method& method, const eckit::Parametrisation& p): a
     // Results seem to indicate that approach=0 is overall better, although approach=1
     // seems to handle pole slightly better (error factor 2 to 4 times lower)
 
+    p.get("fused", fused_);
+    // fused = true:
+    //   gradients of scalar fields scatter each edge contribution directly to its two nodes,
+    //   processing one edge colour at a time, instead of storing edge values to be gathered
+    //   per node. Results differ from the default only by the order of summation.
+
     setup();
 }
 
@@ -82,6 +93,79 @@ void Nabla::setup() {
     for (idx_t jedge = 0; jedge < c; ++jedge) {
         pole_edges_.push_back(tmp[jedge]);
     }
+
+    if (fused_) {
+        setup_edge_colours();
+    }
+}
+
+void Nabla::setup_edge_colours() {
+    const mesh::Edges& edges = fvm_->mesh().edges();
+    const mesh::Nodes& nodes = fvm_->mesh().nodes();
+
+    const idx_t nedges = fvm_->edge_columns().nb_edges();
+
+    const mesh::Connectivity& node2edge           = nodes.edge_connectivity();
+    const mesh::MultiBlockConnectivity& edge2node = edges.node_connectivity();
+
+    // Greedy colouring so that no two edges of the same colour share a node
+    std::vector<idx_t> colour(nedges, -1);
+    std::vector<bool> used;
+    idx_t ncolours = 0;
+    for (idx_t jedge = 0; jedge < nedges; ++jedge) {
+        used.assign(ncolours + 1, false);
+        for (idx_t jside = 0; jside < 2; ++jside) {
+            const idx_t inode = edge2node(jedge, jside);
+            for (idx_t j = 0; j < node2edge.cols(inode); ++j) {
+                const idx_t iedge = node2edge(inode, j);
+                if (iedge < nedges && colour[iedge] >= 0) {
+                    used[colour[iedge]] = true;
+                }
+            }
+        }
+        idx_t c = 0;
+        while (used[c]) {
+            ++c;
+        }
+        colour[jedge] = c;
+        ncolours      = std::max(ncolours, c + 1);
+    }
+
+    // Sort edges by colour, keeping ascending edge order within each colour
+    colour_offsets_.assign(ncolours + 1, 0);
+    for (idx_t jedge = 0; jedge < nedges; ++jedge) {
+        ++colour_offsets_[colour[jedge] + 1];
+    }
+    for (idx_t jcolour = 0; jcolour < ncolours; ++jcolour) {
+        colour_offsets_[jcolour + 1] += colour_offsets_[jcolour];
+    }
+    std::vector<idx_t> position(colour_offsets_.begin(), colour_offsets_.end() - 1);
+    coloured_edges_.resize(nedges);
+    for (idx_t jedge = 0; jedge < nedges; ++jedge) {
+        coloured_edges_[position[colour[jedge]]++] = jedge;
+    }
+    Log::debug() << "Nabla edges divided in " << ncolours << " colours" << std::endl;
+}
+
+template <>
+std::vector<double>& Nabla::workspace<double>() const {
+    return workspace_double_;
+}
+
+template <>
+std::vector<float>& Nabla::workspace<float>() const {
+    return workspace_float_;
+}
+
+template <typename Value>
+array::LocalView<Value, 3> Nabla::edge_workspace(idx_t nedges, idx_t n1, idx_t n2) const {
+    auto& ws          = workspace<Value>();
+    const size_t size = static_cast<size_t>(nedges) * static_cast<size_t>(n1) * static_cast<size_t>(n2);
+    if (ws.size() < size) {
+        ws.resize(size);
+    }
+    const idx_t shape[3] = {nedges, n1, n2};
+    return array::LocalView<Value, 3>(ws.data(), shape);
 }
 
 void Nabla::gradient(const Field& field, Field& grad_field) const {
@@ -93,11 +177,42 @@ void Nabla::gradient(const Field& field, Field& grad_field) const {
     }
 }
 
+void Nabla::gradient(const FieldSet& scalars, FieldSet& grads) const {
+    ATLAS_ASSERT(scalars.size() == grads.size());
+
+    // Scalar fields with equal datatype and levels are differentiated in one sweep over the edges
+    std::map<std::pair<DataType::kind_t, idx_t>, std::pair<std::vector<Field>, std::vector<Field>>> groups;
+    for (idx_t jfield = 0; jfield < scalars.size(); ++jfield) {
+        const Field& field = scalars[jfield];
+        if (field.variables() > 1) {
+            gradient_of_vector(field, grads[jfield]);
+        }
+        else {
+            auto& group = groups[std::make_pair(field.datatype().kind(), field.levels())];
+            group.first.emplace_back(field);
+            group.second.emplace_back(grads[jfield]);
+        }
+    }
+    for (auto& group : groups) {
+        gradient_of_scalars(group.second.first, group.second.second);
+    }
+}
+
 void Nabla::gradient_of_scalar(const Field& scalar_field, Field& grad_field) const {
     Log::debug() << "Compute gradient of scalar field " << scalar_field.name() << " with fvm method" << std::endl;
+    std::vector<Field> scalars{scalar_field};
+    std::vector<Field> grads{grad_field};
+    gradient_of_scalars(scalars, grads);
+}
+
+void Nabla::gradient_of_scalars(const std::vector<Field>& scalar_fields, std::vector<Field>& grad_fields) const {
+    ATLAS_ASSERT(scalar_fields.size() == grad_fields.size());
+    if (scalar_fields.empty()) {
+        return;
+    }
 
     auto dispatch = [&](auto value) {
-        using Value          = std::decay_t<decltype(value)>;
+        using Value = std::decay_t<decltype(value)>;
 
         const Value radius  = fvm_->radius();
         const Value deg2rad = M_PI / 180.;
@@ -108,72 +223,145 @@ void Nabla::gradient_of_scalar(const Field& scalar_field, Field& grad_field) con
         const idx_t nnodes = fvm_->node_columns().nb_nodes();
         const idx_t nedges = fvm_->edge_columns().nb_edges();
 
-        const auto scalar = scalar_field.levels()
-                                ? array::make_view<Value, 2>(scalar_field).slice(Range::all(), Range::all())
-                                : array::make_view<Value, 1>(scalar_field).slice(Range::all(), Range::dummy());
-        auto grad         = grad_field.levels()
-                                ? array::make_view<Value, 3>(grad_field).slice(Range::all(), Range::all(), Range::all())
-                                : array::make_view<Value, 2>(grad_field).slice(Range::all(), Range::dummy(), Range::all());
+        auto make_scalar_view = [](const Field& field) {
+            return field.levels() ? array::make_view<Value, 2>(field).slice(Range::all(), Range::all())
+                                  : array::make_view<Value, 1>(field).slice(Range::all(), Range::dummy());
+        };
+        auto make_grad_view = [](Field& field) {
+            return field.levels()
+                       ? array::make_view<Value, 3>(field).slice(Range::all(), Range::all(), Range::all())
+                       : array::make_view<Value, 2>(field).slice(Range::all(), Range::dummy(), Range::all());
+        };
 
-        const idx_t nlev = scalar.shape(1);
-        if (grad.shape(1) != nlev) {
-            throw_AssertionFailed("gradient field should have same number of levels", Here());
+        const idx_t nfld = static_cast<idx_t>(scalar_fields.size());
+        std::vector<decltype(make_scalar_view(scalar_fields[0]))> scalars;
+        std::vector<decltype(make_grad_view(grad_fields[0]))> grads;
+        scalars.reserve(nfld);
+        grads.reserve(nfld);
+        for (idx_t jfld = 0; jfld < nfld; ++jfld) {
+            ATLAS_ASSERT(scalar_fields[jfld].datatype() == grad_fields[jfld].datatype());
+            scalars.emplace_back(make_scalar_view(scalar_fields[jfld]));
+            grads.emplace_back(make_grad_view(grad_fields[jfld]));
+        }
+
+        const idx_t nlev = scalars[0].shape(1);
+        for (idx_t jfld = 0; jfld < nfld; ++jfld) {
+            if (scalars[jfld].shape(1) != nlev || grads[jfld].shape(1) != nlev) {
+                throw_AssertionFailed("gradient field should have same number of levels", Here());
+            }
         }
 
         const auto lonlat_deg     = array::make_view<double, 2>(nodes.lonlat());
         const auto dual_volumes   = array::make_view<double, 1>(nodes.field("dual_volumes"));
         const auto dual_normals   = array::make_view<double, 2>(edges.field("dual_normals"));
         const auto node2edge_sign = array::make_view<double, 2>(nodes.field("node2edge_sign"));
+        const auto edge_flags     = array::make_view<int, 1>(edges.flags());
+        auto is_pole_edge         = [&](idx_t e) { return Topology::check(edge_flags(e), Topology::POLE); };
 
         const mesh::Connectivity& node2edge           = nodes.edge_connectivity();
         const mesh::MultiBlockConnectivity& edge2node = edges.node_connectivity();
 
-        array::ArrayT<Value> avgS_arr(nedges, nlev, 2ul);
-        auto avgS = array::make_view<Value, 3>(avgS_arr);
-
         const Value scale = deg2rad * deg2rad * radius;
 
+        auto apply_metric = [&](idx_t jnode) {
+            const Value y        = lonlat_deg(jnode, LAT) * deg2rad;
+            const Value metric_y = Value{1.} / (static_cast<Value>(dual_volumes(jnode)) * scale);
+            const Value metric_x = metric_y / std::cos(y);
+            for (idx_t jfld = 0; jfld < nfld; ++jfld) {
+                auto& grad = grads[jfld];
+                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                    grad(jnode, jlev, LON) *= metric_x;
+                    grad(jnode, jlev, LAT) *= metric_y;
+                }
+            }
+        };
+
+        if (fused_) {
+            atlas_omp_parallel_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+                for (idx_t jfld = 0; jfld < nfld; ++jfld) {
+                    auto& grad = grads[jfld];
+                    for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                        grad(jnode, jlev, LON) = 0.;
+                        grad(jnode, jlev, LAT) = 0.;
+                    }
+                }
+            }
+            // Edges of one colour share no node, so each colour is scattered concurrently
+            for (size_t jcolour = 0; jcolour + 1 < colour_offsets_.size(); ++jcolour) {
+                atlas_omp_parallel_for(idx_t j = colour_offsets_[jcolour]; j < colour_offsets_[jcolour + 1]; ++j) {
+                    const idx_t jedge = coloured_edges_[j];
+                    const idx_t ip1   = edge2node(jedge, 0);
+                    const idx_t ip2   = edge2node(jedge, 1);
+                    const Value add2  = is_pole_edge(jedge) ? Value{1.} : Value{-1.};
+                    const Value S[2]  = {static_cast<Value>(dual_normals(jedge, LON)) * deg2rad,
+                                         static_cast<Value>(dual_normals(jedge, LAT)) * deg2rad};
+                    for (idx_t jfld = 0; jfld < nfld; ++jfld) {
+                        const auto& scalar = scalars[jfld];
+                        auto& grad         = grads[jfld];
+                        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                            const Value avg     = (scalar(ip1, jlev) + scalar(ip2, jlev)) * Value{0.5};
+                            const Value avgS[2] = {S[LON] * avg, S[LAT] * avg};
+                            if (ip1 < nnodes) {
+                                grad(ip1, jlev, LON) += avgS[LON];
+                                grad(ip1, jlev, LAT) += avgS[LAT];
+                            }
+                            if (ip2 < nnodes) {
+                                grad(ip2, jlev, LON) += add2 * avgS[LON];
+                                grad(ip2, jlev, LAT) += add2 * avgS[LAT];
+                            }
+                        }
+                    }
+                }
+            }
+            atlas_omp_parallel_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+                apply_metric(jnode);
+            }
+            return;
+        }
+
+        // Only the edge averages are stored; the dual normals are applied when gathering at the nodes
+        auto avg = edge_workspace<Value>(nedges, nfld, nlev);
+
         atlas_omp_parallel {
             atlas_omp_for(idx_t jedge = 0; jedge < nedges; ++jedge) {
-                idx_t ip1 = edge2node(jedge, 0);
-                idx_t ip2 = edge2node(jedge, 1);
-                Value S[2] = { static_cast<Value>(dual_normals(jedge, LON)), static_cast<Value>(dual_normals(jedge, LAT))};
-
-                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                    Value avg              = (scalar(ip1, jlev) + scalar(ip2, jlev)) * Value{0.5};
-                    avgS(jedge, jlev, LON) = S[LON] * deg2rad * avg;
-                    avgS(jedge, jlev, LAT) = S[LAT] * deg2rad * avg;
+                const idx_t ip1 = edge2node(jedge, 0);
+                const idx_t ip2 = edge2node(jedge, 1);
+                for (idx_t jfld = 0; jfld < nfld; ++jfld) {
+                    const auto& scalar = scalars[jfld];
+                    for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                        avg(jedge, jfld, jlev) = (scalar(ip1, jlev) + scalar(ip2, jlev)) * Value{0.5};
+                    }
                 }
             }
 
             atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
-                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                    grad(jnode, jlev, LON) = 0.;
-                    grad(jnode, jlev, LAT) = 0.;
+                for (idx_t jfld = 0; jfld < nfld; ++jfld) {
+                    auto& grad = grads[jfld];
+                    for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                        grad(jnode, jlev, LON) = 0.;
+                        grad(jnode, jlev, LAT) = 0.;
+                    }
                 }
                 for (idx_t jedge = 0; jedge < node2edge.cols(jnode); ++jedge) {
                     const idx_t iedge = node2edge(jnode, jedge);
                     if (iedge < nedges) {
                         const Value add = node2edge_sign(jnode, jedge);
-                        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                            grad(jnode, jlev, LON) += add * avgS(iedge, jlev, LON);
-                            grad(jnode, jlev, LAT) += add * avgS(iedge, jlev, LAT);
+                        const Value S[2] = {static_cast<Value>(dual_normals(iedge, LON)) * deg2rad,
+                                            static_cast<Value>(dual_normals(iedge, LAT)) * deg2rad};
+                        for (idx_t jfld = 0; jfld < nfld; ++jfld) {
+                            auto& grad = grads[jfld];
+                            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                                grad(jnode, jlev, LON) += add * (S[LON] * avg(iedge, jfld, jlev));
+                                grad(jnode, jlev, LAT) += add * (S[LAT] * avg(iedge, jfld, jlev));
+                            }
                         }
                     }
                 }
-
-                const Value y        = lonlat_deg(jnode, LAT) * deg2rad;
-                const Value metric_y = Value{1.} / (static_cast<Value>(dual_volumes(jnode)) * scale);
-                const Value metric_x = metric_y / std::cos(y);
-                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                    grad(jnode, jlev, LON) *= metric_x;
-                    grad(jnode, jlev, LAT) *= metric_y;
-                }
+                apply_metric(jnode);
             }
         }
     };
-    ATLAS_ASSERT( scalar_field.datatype() == grad_field.datatype() );
-    switch (scalar_field.datatype().kind()) {
+    switch (scalar_fields[0].datatype().kind()) {
         case (DataType::KIND_REAL32): {
             dispatch(float{});
             break;
@@ -227,8 +415,7 @@ void Nabla::gradient_of_vector(const Field& vector_field, Field& grad_field) con
         const mesh::Connectivity& node2edge           = nodes.edge_connectivity();
         const mesh::MultiBlockConnectivity& edge2node = edges.node_connectivity();
 
-        array::ArrayT<Value> avgS_arr(nedges, nlev, 4ul);
-        array::ArrayView<Value, 3> avgS = array::make_view<Value, 3>(avgS_arr);
+        auto avgS = edge_workspace<Value>(nedges, nlev, 4);
 
         const Value scale = deg2rad * deg2rad * radius;
 
@@ -355,8 +542,7 @@ void Nabla::divergence(const Field& vector_field, Field& div_field) const {
         const mesh::Connectivity& node2edge           = nodes.edge_connectivity();
         const mesh::MultiBlockConnectivity& edge2node = edges.node_connectivity();
 
-        array::ArrayT<Value> avgS_arr(nedges, nlev, 2ul);
-        array::ArrayView<Value, 3> avgS = array::make_view<Value, 3>(avgS_arr);
+        auto avgS = edge_workspace<Value>(nedges, nlev, 2);
 
         const Value scale = deg2rad * deg2rad * radius;
 
@@ -474,8 +660,7 @@ void Nabla::curl(const Field& vector_field, Field& curl_field) const {
         const mesh::Connectivity& node2edge           = nodes.edge_connectivity();
         const mesh::MultiBlockConnectivity& edge2node = edges.node_connectivity();
 
-        array::ArrayT<Value> avgS_arr(nedges, nlev, 2ul);
-        array::ArrayView<Value, 3> avgS = array::make_view<Value, 3>(avgS_arr);
+        auto avgS = edge_workspace<Value>(nedges, nlev, 2);
 
         const Value scale = deg2rad * deg2rad * radius;
 
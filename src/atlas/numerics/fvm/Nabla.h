@@ -12,6 +12,7 @@
 
 #include <vector>
 
+#include "atlas/array/LocalView.h"
 #include "atlas/library/config.h"
 #include "atlas/numerics/Nabla.h"
 
@@ -25,6 +26,7 @@ class Method;
 
 namespace atlas {
 class Field;
+class FieldSet;
 }
 
 namespace atlas {
@@ -38,6 +40,7 @@ public:
     virtual ~Nabla() override;
 
     virtual void gradient(const Field& scalar, Field& grad) const override;
+    virtual void gradient(const FieldSet& scalars, FieldSet& grads) const override;
     virtual void divergence(const Field& vector, Field& div) const override;
     virtual void curl(const Field& vector, Field& curl) const override;
     virtual void laplacian(const Field& scalar, Field& laplacian) const override;
@@ -47,13 +50,32 @@ public:
 private:
     void setup();
 
+    void setup_edge_colours();
+
     void gradient_of_scalar(const Field& scalar, Field& grad) const;
+    void gradient_of_scalars(const std::vector<Field>& scalars, std::vector<Field>& grads) const;
     void gradient_of_vector(const Field& vector, Field& grad) const;
 
+    template <typename Value>
+    std::vector<Value>& workspace() const;
+
+    template <typename Value>
+    array::LocalView<Value, 3> edge_workspace(idx_t nedges, idx_t n1, idx_t n2) const;
+
 private:
     fvm::Method const* fvm_;
     std::vector<idx_t> pole_edges_;
     int metric_approach_{0};
+
+    // Scatter edge contributions directly to the nodes, one edge colour at a time
+    bool fused_{false};
+    std::vector<idx_t> coloured_edges_;
+    std::vector<idx_t> colour_offsets_;
+
+    // Edge temporaries, kept between calls to avoid reallocation.
+    // A Nabla instance must therefore not be used concurrently from several threads.
+    mutable std::vector<double> workspace_double_;
+    mutable std::vector<float> workspace_float_;
 };
 #endif
 // ------------------------------------------------------------------
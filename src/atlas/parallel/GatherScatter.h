@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <functional>
 #include <numeric>
 #include <stdexcept>
 #include <type_traits>
@@ -17,7 +18,9 @@
 
 #include "atlas/array/ArrayView.h"
 #include "atlas/library/config.h"
+#include "atlas/parallel/detail/PackBuffer.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/util/Object.h"
 
@@ -329,40 +332,45 @@ void GatherScatter::pack_send_buffer(const parallel::Field<DATA_TYPE const>& fie
                                      DATA_TYPE send_buffer[]) const {
     const idx_t sendcnt = static_cast<idx_t>(sendmap.size());
 
-    idx_t ibuf              = 0;
     const idx_t send_stride = field.var_strides[0] * field.var_shape[0];
+    const idx_t var_size    = std::accumulate(field.var_shape.begin(), field.var_shape.end(), idx_t{1},
+                                              std::multiplies<idx_t>());
+    ATLAS_MAYBE_UNUSED const size_t n = size_t(sendcnt) * size_t(var_size);
 
     switch (field.var_rank) {
         case 1:
+            atlas_omp_pragma(omp parallel for schedule(static) if(n > detail::pack_omp_threshold))
             for (idx_t p = 0; p < sendcnt; ++p) {
                 const idx_t pp = send_stride * sendmap[p];
-                for (idx_t i = 0; i < field.var_shape[0]; ++i) {
-                    DATA_TYPE tmp       = field.data[pp + i * field.var_strides[0]];
-                    send_buffer[ibuf++] = tmp;
-                }
+                detail::pack_strided(send_buffer + size_t(p) * var_size, field.data + pp, field.var_shape[0],
+                                     field.var_strides[0]);
             }
             break;
         case 2:
+            atlas_omp_pragma(omp parallel for schedule(static) if(n > detail::pack_omp_threshold))
             for (idx_t p = 0; p < sendcnt; ++p) {
                 const idx_t pp = send_stride * sendmap[p];
+                size_t ibuf    = size_t(p) * var_size;
                 for (idx_t i = 0; i < field.var_shape[0]; ++i) {
                     const idx_t ii = pp + i * field.var_strides[0];
-                    for (idx_t j = 0; j < field.var_shape[1]; ++j) {
-                        send_buffer[ibuf++] = field.data[ii + j * field.var_strides[1]];
-                    }
+                    detail::pack_strided(send_buffer + ibuf, field.data + ii, field.var_shape[1],
+                                         field.var_strides[1]);
+                    ibuf += field.var_shape[1];
                 }
             }
             break;
         case 3:
+            atlas_omp_pragma(omp parallel for schedule(static) if(n > detail::pack_omp_threshold))
             for (idx_t p = 0; p < sendcnt; ++p) {
                 const idx_t pp = send_stride * sendmap[p];
+                size_t ibuf    = size_t(p) * var_size;
                 for (idx_t i = 0; i < field.var_shape[0]; ++i) {
                     const idx_t ii = pp + i * field.var_strides[0];
                     for (idx_t j = 0; j < field.var_shape[1]; ++j) {
                         const idx_t jj = ii + j * field.var_strides[1];
-                        for (idx_t k = 0; k < field.var_shape[2]; ++k) {
-                            send_buffer[ibuf++] = field.data[jj + k * field.var_strides[2]];
-                        }
+                        detail::pack_strided(send_buffer + ibuf, field.data + jj, field.var_shape[2],
+                                             field.var_strides[2]);
+                        ibuf += field.var_shape[2];
                     }
                 }
             }
@@ -377,39 +385,45 @@ void GatherScatter::unpack_recv_buffer(const std::vector<int>& recvmap, const DA
                                        const parallel::Field<DATA_TYPE>& field) const {
     const idx_t recvcnt = static_cast<idx_t>(recvmap.size());
 
-    size_t ibuf             = 0;
     const idx_t recv_stride = field.var_strides[0] * field.var_shape[0];
+    const idx_t var_size    = std::accumulate(field.var_shape.begin(), field.var_shape.end(), idx_t{1},
+                                              std::multiplies<idx_t>());
+    ATLAS_MAYBE_UNUSED const size_t n = size_t(recvcnt) * size_t(var_size);
 
     switch (field.var_rank) {
         case 1:
+            atlas_omp_pragma(omp parallel for schedule(static) if(n > detail::pack_omp_threshold))
             for (idx_t p = 0; p < recvcnt; ++p) {
                 const idx_t pp = recv_stride * recvmap[p];
-                for (idx_t i = 0; i < field.var_shape[0]; ++i) {
-                    field.data[pp + i * field.var_strides[0]] = recv_buffer[ibuf++];
-                }
+                detail::unpack_strided(recv_buffer + size_t(p) * var_size, field.data + pp, field.var_shape[0],
+                                       field.var_strides[0]);
             }
             break;
         case 2:
+            atlas_omp_pragma(omp parallel for schedule(static) if(n > detail::pack_omp_threshold))
             for (idx_t p = 0; p < recvcnt; ++p) {
                 const idx_t pp = recv_stride * recvmap[p];
+                size_t ibuf    = size_t(p) * var_size;
                 for (idx_t i = 0; i < field.var_shape[0]; ++i) {
                     const idx_t ii = pp + i * field.var_strides[0];
-                    for (idx_t j = 0; j < field.var_shape[1]; ++j) {
-                        field.data[ii + j * field.var_strides[1]] = recv_buffer[ibuf++];
-                    }
+                    detail::unpack_strided(recv_buffer + ibuf, field.data + ii, field.var_shape[1],
+                                           field.var_strides[1]);
+                    ibuf += field.var_shape[1];
                 }
             }
             break;
         case 3:
+            atlas_omp_pragma(omp parallel for schedule(static) if(n > detail::pack_omp_threshold))
             for (idx_t p = 0; p < recvcnt; ++p) {
                 const idx_t pp = recv_stride * recvmap[p];
+                size_t ibuf    = size_t(p) * var_size;
                 for (idx_t i = 0; i < field.var_shape[0]; ++i) {
                     const idx_t ii = pp + i * field.var_strides[0];
                     for (idx_t j = 0; j < field.var_shape[1]; ++j) {
                         const idx_t jj = ii + j * field.var_strides[1];
-                        for (idx_t k = 0; k < field.var_shape[2]; ++k) {
-                            field.data[jj + k * field.var_strides[2]] = recv_buffer[ibuf++];
-                        }
+                        detail::unpack_strided(recv_buffer + ibuf, field.data + jj, field.var_shape[2],
+                                               field.var_strides[2]);
+                        ibuf += field.var_shape[2];
                     }
                 }
             }
@@ -12,14 +12,18 @@
 /// @author Willem Deconinck
 /// @date   Nov 2013
 
+#include <cstddef>
 #include <memory>
 #include <numeric>
 #include <sstream>
 #include <stdexcept>
+#include <utility>
 
 #include "atlas/array/Array.h"
 #include "atlas/parallel/HaloExchange.h"
 #include "atlas/parallel/mpi/Statistics.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/util/Allocate.h"
 #include "atlas/util/vector.h"
 
 namespace atlas {
@@ -75,6 +79,7 @@ void HaloExchange::setup(const std::string& mpi_comm, const int part[], const id
 
 void HaloExchange::setup(const std::string& mpi_comm, const int part[], const idx_t remote_idx[], const int base, idx_t parsize, idx_t halo_begin) {
     ATLAS_TRACE("HaloExchange::setup");
+    buffer_pool_.clear();
     comm_ = &mpi::comm(mpi_comm);
     myproc = comm().rank();
     nproc  = comm().size();
@@ -181,6 +186,369 @@ void HaloExchange::wait_for_send(std::vector<int>& send_counts_init, std::vector
 
 namespace {
 
+// Byte alignment of every array segment within the aggregated send and receive buffers
+constexpr size_t aggregate_alignment = alignof(std::max_align_t);
+
+size_t aggregate_aligned(size_t bytes) {
+    return ((bytes + aggregate_alignment - 1) / aggregate_alignment) * aggregate_alignment;
+}
+
+template <typename DATA_TYPE, int RANK>
+void aggregate_pack(array::Array& array, const int map[], int count, void* buffer) {
+    auto field = array::make_host_view<DATA_TYPE, RANK>(array);
+    halo_packer<0, RANK>::pack(count, map, field, static_cast<DATA_TYPE*>(buffer));
+}
+
+template <typename DATA_TYPE, int RANK>
+void aggregate_unpack(array::Array& array, const int map[], int count, const void* buffer) {
+    auto field = array::make_host_view<DATA_TYPE, RANK>(array);
+    halo_packer<0, RANK>::unpack(count, map, static_cast<const DATA_TYPE*>(buffer), field);
+}
+
+}  // namespace
+
+namespace detail {
+
+/// Type-erased packing of one array taking part in an aggregated halo exchange
+struct HaloExchangeArray {
+    using pack_t   = void (*)(array::Array&, const int[], int, void*);
+    using unpack_t = void (*)(array::Array&, const int[], int, const void*);
+
+    array::Array* array;
+    size_t bytes_per_point;
+    pack_t pack;
+    unpack_t unpack;
+
+    template <typename DATA_TYPE>
+    void setup() {
+        switch (array->rank()) {
+            case 1:
+                pack   = &aggregate_pack<DATA_TYPE, 1>;
+                unpack = &aggregate_unpack<DATA_TYPE, 1>;
+                break;
+            case 2:
+                pack   = &aggregate_pack<DATA_TYPE, 2>;
+                unpack = &aggregate_unpack<DATA_TYPE, 2>;
+                break;
+            case 3:
+                pack   = &aggregate_pack<DATA_TYPE, 3>;
+                unpack = &aggregate_unpack<DATA_TYPE, 3>;
+                break;
+            case 4:
+                pack   = &aggregate_pack<DATA_TYPE, 4>;
+                unpack = &aggregate_unpack<DATA_TYPE, 4>;
+                break;
+            default:
+                throw_NotImplemented("Rank not supported in halo exchange", Here());
+        }
+    }
+
+    HaloExchangeArray(array::Array& _array): array(&_array) {
+        size_t var_size = 1;
+        for (idx_t j = 1; j < array->rank(); ++j) {
+            var_size *= array->shape(j);
+        }
+        bytes_per_point = var_size * array->datatype().size();
+
+        auto kind = array->datatype().kind();
+        if (kind == array::DataType::kind<int>()) {
+            setup<int>();
+        }
+        else if (kind == array::DataType::kind<long>()) {
+            setup<long>();
+        }
+        else if (kind == array::DataType::kind<float>()) {
+            setup<float>();
+        }
+        else if (kind == array::DataType::kind<double>()) {
+            setup<double>();
+        }
+        else {
+            throw_Exception("datatype not supported", Here());
+        }
+    }
+};
+
+}  // namespace detail
+
+namespace {
+
+template <typename DATA_TYPE>
+void execute_single(const HaloExchange& halo_exchange, array::Array& array, bool on_device) {
+    switch (array.rank()) {
+        case 1:
+            halo_exchange.execute<DATA_TYPE, 1>(array, on_device);
+            break;
+        case 2:
+            halo_exchange.execute<DATA_TYPE, 2>(array, on_device);
+            break;
+        case 3:
+            halo_exchange.execute<DATA_TYPE, 3>(array, on_device);
+            break;
+        case 4:
+            halo_exchange.execute<DATA_TYPE, 4>(array, on_device);
+            break;
+        default:
+            throw_NotImplemented("Rank not supported in halo exchange", Here());
+    }
+}
+
+void execute_single(const HaloExchange& halo_exchange, array::Array& array, bool on_device) {
+    auto kind = array.datatype().kind();
+    if (kind == array::DataType::kind<int>()) {
+        execute_single<int>(halo_exchange, array, on_device);
+    }
+    else if (kind == array::DataType::kind<long>()) {
+        execute_single<long>(halo_exchange, array, on_device);
+    }
+    else if (kind == array::DataType::kind<float>()) {
+        execute_single<float>(halo_exchange, array, on_device);
+    }
+    else if (kind == array::DataType::kind<double>()) {
+        execute_single<double>(halo_exchange, array, on_device);
+    }
+    else {
+        throw_Exception("datatype not supported", Here());
+    }
+}
+
+}  // namespace
+
+HaloExchangeHandle::HaloExchangeHandle() = default;
+
+HaloExchangeHandle::HaloExchangeHandle(HaloExchangeHandle&& other):
+    active_(other.active_),
+    arrays_(std::move(other.arrays_)),
+    buffers_(std::move(other.buffers_)),
+    on_finish_(std::move(other.on_finish_)) {
+    other.active_ = false;
+}
+
+HaloExchangeHandle& HaloExchangeHandle::operator=(HaloExchangeHandle&& other) {
+    if (this != &other) {
+        abandon();
+        active_       = other.active_;
+        arrays_       = std::move(other.arrays_);
+        buffers_      = std::move(other.buffers_);
+        on_finish_    = std::move(other.on_finish_);
+        other.active_ = false;
+    }
+    return *this;
+}
+
+HaloExchangeHandle::~HaloExchangeHandle() {
+    abandon();
+}
+
+void HaloExchangeHandle::abandon() {
+    if (active_ && buffers_) {
+        // MPI may still be reading from or writing to the buffers, which must not be returned to the pool before
+        // all messages have completed. The arrays may no longer exist, so the halos are not unpacked.
+        try {
+            buffers_->wait();
+        }
+        catch (const std::exception& e) {
+            Log::error() << "HaloExchangeHandle: waiting for messages of an unfinished exchange failed: " << e.what()
+                         << std::endl;
+        }
+    }
+    buffers_.reset();
+    arrays_.clear();
+    on_finish_.clear();
+    active_ = false;
+}
+
+std::shared_ptr<detail::HaloExchangeBuffers> HaloExchange::acquire_buffers(const std::vector<size_t>& key) const {
+    std::lock_guard<std::mutex> lock(buffer_pool_mutex_);
+    auto found = buffer_pool_.find(key);
+    if (found == buffer_pool_.end()) {
+        // Release the least recently used layout. Buffers of an exchange in flight are kept alive by its handle
+        // and released when it finishes.
+        if (buffer_pool_.size() >= max_pooled_layouts()) {
+            auto lru = buffer_pool_.begin();
+            for (auto it = buffer_pool_.begin(); it != buffer_pool_.end(); ++it) {
+                if (it->second.last_use < lru->second.last_use) {
+                    lru = it;
+                }
+            }
+            buffer_pool_.erase(lru);
+        }
+        found = buffer_pool_.emplace(key, PooledBuffers{}).first;
+    }
+    found->second.last_use = ++buffer_pool_clock_;
+    auto& pool             = found->second.buffers;
+    for (auto& buffers : pool) {
+        if (buffers.use_count() == 1) {
+            return buffers;
+        }
+    }
+
+    ATLAS_TRACE("HaloExchange::acquire_buffers");
+    bool on_device      = key[0];
+    size_t element_size = key[1];
+
+    std::size_t nproc_loc(static_cast<std::size_t>(nproc));
+    auto buffers       = std::make_shared<detail::HaloExchangeBuffers>();
+    buffers->comm      = comm_;
+    buffers->on_device = on_device;
+    buffers->inner_counts.assign(nproc_loc, 0);
+    buffers->halo_counts.assign(nproc_loc, 0);
+    buffers->inner_displs.assign(nproc_loc, 0);
+    buffers->halo_displs.assign(nproc_loc, 0);
+    buffers->inner_req.resize(nproc_loc);
+    buffers->halo_req.resize(nproc_loc);
+
+    for (size_t jproc = 0; jproc < nproc_loc; ++jproc) {
+        for (size_t j = 2; j < key.size(); ++j) {
+            size_t inner_bytes = sendcounts_[jproc] * key[j];
+            size_t halo_bytes  = recvcounts_[jproc] * key[j];
+            if (element_size == 1) {
+                inner_bytes = aggregate_aligned(inner_bytes);
+                halo_bytes  = aggregate_aligned(halo_bytes);
+            }
+            buffers->inner_counts[jproc] += inner_bytes / element_size;
+            buffers->halo_counts[jproc] += halo_bytes / element_size;
+        }
+    }
+    for (size_t jproc = 1; jproc < nproc_loc; ++jproc) {
+        buffers->inner_displs[jproc] = buffers->inner_displs[jproc - 1] + buffers->inner_counts[jproc - 1];
+        buffers->halo_displs[jproc]  = buffers->halo_displs[jproc - 1] + buffers->halo_counts[jproc - 1];
+    }
+    buffers->inner_bytes = (buffers->inner_displs.back() + buffers->inner_counts.back()) * element_size;
+    buffers->halo_bytes  = (buffers->halo_displs.back() + buffers->halo_counts.back()) * element_size;
+
+    if (on_device) {
+        util::allocate_devicemem(buffers->inner_buffer, buffers->inner_bytes);
+        util::allocate_devicemem(buffers->halo_buffer, buffers->halo_bytes);
+    }
+    else {
+        util::allocate_hostmem(buffers->inner_buffer, buffers->inner_bytes);
+        util::allocate_hostmem(buffers->halo_buffer, buffers->halo_bytes);
+    }
+
+    pool.emplace_back(buffers);
+    return buffers;
+}
+
+size_t HaloExchange::pooled_layouts() const {
+    std::lock_guard<std::mutex> lock(buffer_pool_mutex_);
+    return buffer_pool_.size();
+}
+
+void HaloExchange::execute(const std::vector<array::Array*>& arrays, bool on_device) const {
+    auto handle = start(arrays, on_device);
+    finish(handle);
+}
+
+HaloExchangeHandle HaloExchange::start(array::Array& array, bool on_device) const {
+    return start(std::vector<array::Array*>{&array}, on_device);
+}
+
+HaloExchangeHandle HaloExchange::start(const std::vector<array::Array*>& arrays, bool on_device) const {
+    if (!is_setup_) {
+        throw_Exception("HaloExchange was not setup", Here());
+    }
+
+    ATLAS_TRACE("HaloExchange::start", {"halo-exchange"});
+
+    HaloExchangeHandle handle;
+    handle.active_ = true;
+
+    if (on_device) {
+        // Aggregated packing is only implemented on the host; exchange arrays one by one
+        for (auto* array : arrays) {
+            execute_single(*this, *array, on_device);
+        }
+        return handle;
+    }
+
+    // Message sizes and buffer displacements are in bytes
+    std::vector<size_t> key{0, 1};
+    key.reserve(arrays.size() + 2);
+    handle.arrays_.reserve(arrays.size());
+    for (auto* array : arrays) {
+        handle.arrays_.emplace_back(*array);
+        key.emplace_back(handle.arrays_.back().bytes_per_point);
+    }
+    handle.buffers_ = acquire_buffers(key);
+    auto& buffers   = *handle.buffers_;
+
+    std::size_t nproc_loc(static_cast<std::size_t>(nproc));
+    int tag(1);
+    ireceive<char>(tag, buffers.halo_displs, buffers.halo_counts, buffers.halo_req, buffers.halo_buffer);
+
+    /// Pack
+    ATLAS_TRACE_SCOPE("pack_send_buffer") {
+        for (size_t jproc = 0; jproc < nproc_loc; ++jproc) {
+            size_t offset = buffers.inner_displs[jproc];
+            for (auto& a : handle.arrays_) {
+                a.pack(*a.array, sendmap_.data() + senddispls_[jproc], sendcounts_[jproc],
+                       buffers.inner_buffer + offset);
+                offset += aggregate_aligned(sendcounts_[jproc] * a.bytes_per_point);
+            }
+        }
+    }
+
+    /// Send
+    ATLAS_TRACE_MPI(ISEND) {
+        for (size_t jproc = 0; jproc < nproc_loc; ++jproc) {
+            if (buffers.inner_counts[jproc] > 0) {
+                buffers.inner_req[jproc] = comm().iSend(buffers.inner_buffer + buffers.inner_displs[jproc],
+                                                        buffers.inner_counts[jproc], jproc, tag);
+            }
+        }
+    }
+    return handle;
+}
+
+void HaloExchange::finish(HaloExchangeHandle& handle) const {
+    if (!handle.active()) {
+        throw_Exception("HaloExchangeHandle is not active", Here());
+    }
+
+    ATLAS_TRACE("HaloExchange::finish", {"halo-exchange"});
+
+    if (handle.buffers_) {
+        auto& buffers = *handle.buffers_;
+        std::size_t nproc_loc(static_cast<std::size_t>(nproc));
+
+        /// Wait for receiving to finish
+        ATLAS_TRACE_MPI(WAIT, "mpi-wait receive") {
+            for (size_t jproc = 0; jproc < nproc_loc; ++jproc) {
+                if (buffers.halo_counts[jproc] > 0) {
+                    comm().wait(buffers.halo_req[jproc]);
+                }
+            }
+        }
+
+        /// Unpack
+        ATLAS_TRACE_SCOPE("unpack_recv_buffer") {
+            for (size_t jproc = 0; jproc < nproc_loc; ++jproc) {
+                size_t offset = buffers.halo_displs[jproc];
+                for (auto& a : handle.arrays_) {
+                    a.unpack(*a.array, recvmap_.data() + recvdispls_[jproc], recvcounts_[jproc],
+                             buffers.halo_buffer + offset);
+                    offset += aggregate_aligned(recvcounts_[jproc] * a.bytes_per_point);
+                }
+            }
+        }
+
+        wait_for_send(buffers.inner_counts, buffers.inner_req);
+    }
+
+    // Return the buffers to the pool
+    handle.buffers_.reset();
+    handle.arrays_.clear();
+    handle.active_ = false;
+
+    for (auto& f : handle.on_finish_) {
+        f();
+    }
+    handle.on_finish_.clear();
+}
+
+namespace {
+
 template <typename Value>
 void execute_halo_exchange(HaloExchange* This, Value field[], int var_strides[], int var_extents[], int var_rank) {
     // WARNING: Only works if there is only one parallel dimension AND being
@@ -14,14 +14,20 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
 #include "atlas/parallel/HaloAdjointExchangeImpl.h"
+#include "atlas/parallel/HaloExchangeHandle.h"
 #include "atlas/parallel/HaloExchangeImpl.h"
+#include "atlas/parallel/detail/PackBuffer.h"
 #include "atlas/parallel/mpi/Statistics.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 
 #include "atlas/array/ArrayView.h"
 #include "atlas/array/ArrayViewDefs.h"
@@ -40,6 +46,60 @@
 namespace atlas {
 namespace parallel {
 
+namespace detail {
+
+/// @brief Communication buffers, message counts and displacements for one layout of a halo exchange
+///
+/// Buffers are kept in a pool by the HaloExchange and reused by subsequent exchanges with the same
+/// layout, so that repeated exchanges do not allocate. See HaloExchange for how long they are retained.
+struct HaloExchangeBuffers {
+    const mpi::Comm* comm{nullptr};
+    bool on_device{false};
+    std::vector<int> inner_counts;
+    std::vector<int> halo_counts;
+    std::vector<int> inner_displs;
+    std::vector<int> halo_displs;
+    std::vector<eckit::mpi::Request> inner_req;
+    std::vector<eckit::mpi::Request> halo_req;
+    char* inner_buffer{nullptr};
+    char* halo_buffer{nullptr};
+    size_t inner_bytes{0};
+    size_t halo_bytes{0};
+
+    /// Wait for all posted receives and sends, without unpacking the received halos
+    void wait() {
+        for (size_t jproc = 0; jproc < halo_counts.size(); ++jproc) {
+            if (halo_counts[jproc] > 0) {
+                comm->wait(halo_req[jproc]);
+            }
+        }
+        for (size_t jproc = 0; jproc < inner_counts.size(); ++jproc) {
+            if (inner_counts[jproc] > 0) {
+                comm->wait(inner_req[jproc]);
+            }
+        }
+    }
+
+    ~HaloExchangeBuffers() {
+        if (on_device) {
+            util::delete_devicemem(inner_buffer, inner_bytes);
+            util::delete_devicemem(halo_buffer, halo_bytes);
+        }
+        else {
+            util::delete_hostmem(inner_buffer, inner_bytes);
+            util::delete_hostmem(halo_buffer, halo_bytes);
+        }
+    }
+};
+
+}  // namespace detail
+
+/// @brief Exchange of halo values between partitions
+///
+/// Communication buffers are pooled per layout, i.e. per combination of device flag and bytes per point
+/// of the exchanged arrays. Buffers of at most max_pooled_layouts() layouts are retained; when an exchange
+/// with a further layout is performed, the buffers of the least recently used layout are released once no
+/// exchange in flight uses them anymore. All pooled buffers are released by setup() and on destruction.
 class HaloExchange : public util::Object {
 public:
     HaloExchange();
@@ -62,16 +122,41 @@ public:  // methods
     template <typename DATA_TYPE, int RANK, typename ParallelDim = array::FirstDim>
     void execute_adjoint(array::Array& field, bool on_device = false) const;
 
+    /// @brief Exchange halos of multiple arrays in a single round of messages
+    ///
+    /// All arrays are packed into one buffer per neighbouring partition, so that the number of
+    /// messages is independent of the number of arrays. Arrays may differ in datatype and rank,
+    /// but their parallel dimension must be the first dimension.
+    void execute(const std::vector<array::Array*>& arrays, bool on_device = false) const;
+
+    /// @brief Start a non-blocking halo exchange of multiple arrays
+    ///
+    /// Receives are posted and the packed buffers are sent. The halos of the arrays are only
+    /// valid after finish() has been called with the returned handle. Exchanges on device are
+    /// performed in full by start().
+    HaloExchangeHandle start(const std::vector<array::Array*>& arrays, bool on_device = false) const;
+    HaloExchangeHandle start(array::Array& array, bool on_device = false) const;
+
+    /// @brief Wait for the messages of a started halo exchange and unpack the halos
+    void finish(HaloExchangeHandle&) const;
+
+    /// @brief Maximum number of layouts for which communication buffers are retained
+    static constexpr size_t max_pooled_layouts() { return 8; }
+
+    /// @brief Number of layouts for which communication buffers are currently retained
+    size_t pooled_layouts() const;
+
 private:  // methods
     idx_t index(idx_t i, idx_t j, idx_t k, idx_t ni, idx_t nj, idx_t /*nk*/) const { return (i + ni * (j + nj * k)); }
 
     idx_t index(idx_t i, idx_t j, idx_t ni, idx_t /*nj*/) const { return (i + ni * j); }
 
-    template <typename DATA_TYPE>
-    void counts_displs_setup(const idx_t var_size, std::vector<int>& send_counts_init,
-                             std::vector<int>& recv_counts_init, std::vector<int>& send_counts,
-                             std::vector<int>& recv_counts, std::vector<int>& send_displs,
-                             std::vector<int>& recv_displs) const;
+    /// @brief Acquire buffers from the pool that are not in use by another exchange
+    ///
+    /// The key is {on_device, element size, bytes per point of each array}. Counts and displacements
+    /// are expressed in elements. With an element size of 1, each array occupies its own segment,
+    /// aligned for any datatype, within the message to each partition.
+    std::shared_ptr<detail::HaloExchangeBuffers> acquire_buffers(const std::vector<size_t>& key) const;
 
 
     template <typename DATA_TYPE>
@@ -86,12 +171,6 @@ private:  // methods
 
     void wait_for_send(std::vector<int>& send_counts, std::vector<eckit::mpi::Request>& send_req) const;
 
-    template <typename DATA_TYPE>
-    DATA_TYPE* allocate_buffer(const int buffer_size, const bool on_device) const;
-
-    template <typename DATA_TYPE>
-    void deallocate_buffer(DATA_TYPE* buffer, const int buffer_size, const bool on_device) const;
-
     template <int ParallelDim, typename DATA_TYPE, int RANK>
     void pack_send_buffer(const array::ArrayView<DATA_TYPE, RANK>& hfield,
                           const array::ArrayView<DATA_TYPE, RANK>& dfield, DATA_TYPE* send_buffer, int send_buffer_size,
@@ -142,6 +221,14 @@ private:  // data
     int myproc;
     const mpi::Comm* comm_;
 
+    struct PooledBuffers {
+        size_t last_use{0};
+        std::vector<std::shared_ptr<detail::HaloExchangeBuffers>> buffers;
+    };
+    mutable std::map<std::vector<size_t>, PooledBuffers> buffer_pool_;
+    mutable size_t buffer_pool_clock_{0};
+    mutable std::mutex buffer_pool_mutex_;
+
 public:
     struct Backdoor {
         int parsize;
@@ -163,16 +250,12 @@ void HaloExchange::execute(array::Array& field, bool on_device) const {
     idx_t var_size            = array::get_var_size<parallelDim>(field_hv);
 
     int tag(1);
-    std::size_t nproc_loc(static_cast<std::size_t>(nproc));
-    std::vector<int> inner_counts(nproc_loc), halo_counts(nproc_loc);
-    std::vector<int> inner_counts_init(nproc_loc), halo_counts_init(nproc_loc);
-    std::vector<int> inner_displs(nproc_loc), halo_displs(nproc_loc);
-    std::vector<eckit::mpi::Request> inner_req(nproc_loc), halo_req(nproc_loc);
+    auto buffers = acquire_buffers({size_t(on_device), sizeof(DATA_TYPE), var_size * sizeof(DATA_TYPE)});
 
     int inner_size          = sendcnt_ * var_size;
     int halo_size           = recvcnt_ * var_size;
-    DATA_TYPE* inner_buffer = allocate_buffer<DATA_TYPE>(inner_size, on_device);
-    DATA_TYPE* halo_buffer  = allocate_buffer<DATA_TYPE>(halo_size, on_device);
+    DATA_TYPE* inner_buffer = reinterpret_cast<DATA_TYPE*>(buffers->inner_buffer);
+    DATA_TYPE* halo_buffer  = reinterpret_cast<DATA_TYPE*>(buffers->halo_buffer);
 
 #if ATLAS_HAVE_GPU
     if (on_device) {
@@ -182,24 +265,18 @@ void HaloExchange::execute(array::Array& field, bool on_device) const {
     }
 #endif
 
-    counts_displs_setup<DATA_TYPE>(var_size, inner_counts_init, halo_counts_init, inner_counts, halo_counts,
-                                   inner_displs, halo_displs);
-
-    ireceive<DATA_TYPE>(tag, halo_displs, halo_counts, halo_req, halo_buffer);
+    ireceive<DATA_TYPE>(tag, buffers->halo_displs, buffers->halo_counts, buffers->halo_req, halo_buffer);
 
     /// Pack
     pack_send_buffer<parallelDim>(field_hv, field_dv, inner_buffer, inner_size, on_device);
 
-    isend_and_wait_for_receive<DATA_TYPE>(tag, halo_counts_init, halo_req, inner_displs, inner_counts, inner_req,
-                                          inner_buffer);
+    isend_and_wait_for_receive<DATA_TYPE>(tag, buffers->halo_counts, buffers->halo_req, buffers->inner_displs,
+                                          buffers->inner_counts, buffers->inner_req, inner_buffer);
 
     /// Unpack
     unpack_recv_buffer<parallelDim>(halo_buffer, halo_size, field_hv, field_dv, on_device);
 
-    wait_for_send(inner_counts_init, inner_req);
-
-    deallocate_buffer<DATA_TYPE>(inner_buffer, inner_size, on_device);
-    deallocate_buffer<DATA_TYPE>(halo_buffer, halo_size, on_device);
+    wait_for_send(buffers->inner_counts, buffers->inner_req);
 }
 
 template <typename DATA_TYPE, int RANK, typename ParallelDim>
@@ -218,80 +295,31 @@ void HaloExchange::execute_adjoint(array::Array& field, bool on_device) const {
     idx_t var_size            = array::get_var_size<parallelDim>(field_hv);
 
     int tag(1);
-    std::size_t nproc_loc(static_cast<std::size_t>(nproc));
-    std::vector<int> halo_counts(nproc_loc), inner_counts(nproc_loc);
-    std::vector<int> halo_counts_init(nproc_loc), inner_counts_init(nproc_loc);
-    std::vector<int> halo_displs(nproc_loc), inner_displs(nproc_loc);
-    std::vector<eckit::mpi::Request> halo_req(nproc_loc), inner_req(nproc_loc);
+    auto buffers = acquire_buffers({size_t(on_device), sizeof(DATA_TYPE), var_size * sizeof(DATA_TYPE)});
 
+    // The adjoint receives into the layout of the forward send buffer, and sends from the layout of
+    // the forward receive buffer
     int halo_size           = sendcnt_ * var_size;
     int inner_size          = recvcnt_ * var_size;
-    DATA_TYPE* halo_buffer  = allocate_buffer<DATA_TYPE>(halo_size, on_device);
-    DATA_TYPE* inner_buffer = allocate_buffer<DATA_TYPE>(inner_size, on_device);
-
-    counts_displs_setup<DATA_TYPE>(var_size, halo_counts_init, inner_counts_init, halo_counts, inner_counts,
-                                   halo_displs, inner_displs);
+    DATA_TYPE* halo_buffer  = reinterpret_cast<DATA_TYPE*>(buffers->inner_buffer);
+    DATA_TYPE* inner_buffer = reinterpret_cast<DATA_TYPE*>(buffers->halo_buffer);
 
-    ireceive<DATA_TYPE>(tag, halo_displs, halo_counts, halo_req, halo_buffer);
+    ireceive<DATA_TYPE>(tag, buffers->inner_displs, buffers->inner_counts, buffers->inner_req, halo_buffer);
 
     /// Pack
     pack_recv_adjoint_buffer<parallelDim>(field_hv, field_dv, inner_buffer, inner_size, on_device);
 
     /// Send
-    isend_and_wait_for_receive<DATA_TYPE>(tag, halo_counts_init, halo_req, inner_displs, inner_counts, inner_req,
-                                          inner_buffer);
+    isend_and_wait_for_receive<DATA_TYPE>(tag, buffers->inner_counts, buffers->inner_req, buffers->halo_displs,
+                                          buffers->halo_counts, buffers->halo_req, inner_buffer);
 
     /// Unpack
     unpack_send_adjoint_buffer<parallelDim>(halo_buffer, halo_size, field_hv, field_dv, on_device);
 
     /// Wait for sending to finish
-    wait_for_send(inner_counts_init, inner_req);
+    wait_for_send(buffers->halo_counts, buffers->halo_req);
 
     zero_halos<parallelDim>(field_hv, field_dv, halo_buffer, halo_size, on_device);
-
-    deallocate_buffer<DATA_TYPE>(halo_buffer, halo_size, on_device);
-    deallocate_buffer<DATA_TYPE>(inner_buffer, inner_size, on_device);
-}
-
-template <typename DATA_TYPE>
-DATA_TYPE* HaloExchange::allocate_buffer(const int buffer_size, const bool on_device) const {
-    DATA_TYPE* buffer{nullptr};
-
-    if (on_device) {
-        util::allocate_devicemem(buffer, buffer_size);
-    }
-    else {
-        util::allocate_hostmem(buffer, buffer_size);
-    }
-
-    return buffer;
-}
-
-
-template <typename DATA_TYPE>
-void HaloExchange::deallocate_buffer(DATA_TYPE* buffer, const int buffer_size, const bool on_device) const {
-    if (on_device) {
-        util::delete_devicemem(buffer, buffer_size);
-    }
-    else {
-        util::delete_hostmem(buffer, buffer_size);
-    }
-}
-
-
-template <typename DATA_TYPE>
-void HaloExchange::counts_displs_setup(const idx_t var_size, std::vector<int>& send_counts_init,
-                                       std::vector<int>& recv_counts_init, std::vector<int>& send_counts,
-                                       std::vector<int>& recv_counts, std::vector<int>& send_displs,
-                                       std::vector<int>& recv_displs) const {
-    for (size_t jproc = 0; jproc < static_cast<size_t>(nproc); ++jproc) {
-        send_counts_init[jproc] = sendcounts_[jproc];
-        recv_counts_init[jproc] = recvcounts_[jproc];
-        send_counts[jproc]      = sendcounts_[jproc] * var_size;
-        recv_counts[jproc]      = recvcounts_[jproc] * var_size;
-        send_displs[jproc]      = senddispls_[jproc] * var_size;
-        recv_displs[jproc]      = recvdispls_[jproc] * var_size;
-    }
 }
 
 template <typename DATA_TYPE>
@@ -334,25 +362,77 @@ void HaloExchange::isend_and_wait_for_receive(int tag, std::vector<int>& recv_co
 
 template <int ParallelDim, int RANK>
 struct halo_packer {
+    /// Number of values per point, i.e. the product of all but the parallel dimension
     template <typename DATA_TYPE>
-    static void pack(const int sendcnt, array::SVector<int> const& sendmap,
-                     const array::ArrayView<DATA_TYPE, RANK>& field, DATA_TYPE* send_buffer, int /*send_buffer_size*/) {
-        idx_t ibuf = 0;
+    static idx_t var_size(const array::ArrayView<DATA_TYPE, RANK>& field) {
+        idx_t size = 1;
+        for (int d = 0; d < RANK; ++d) {
+            if (d != ParallelDim) {
+                size *= field.shape(d);
+            }
+        }
+        return size;
+    }
+
+    /// True when the values of each point are contiguous in memory, in packing order
+    template <typename DATA_TYPE>
+    static bool contiguous_vars(const array::ArrayView<DATA_TYPE, RANK>& field) {
+        return ParallelDim == 0 && field.contiguous();
+    }
+
+    template <typename DATA_TYPE>
+    static void pack(const int sendcnt, const int sendmap[], const array::ArrayView<DATA_TYPE, RANK>& field,
+                     DATA_TYPE* send_buffer) {
+        const idx_t var_size       = halo_packer::var_size(field);
+        const bool contiguous      = contiguous_vars(field);
+        const size_t point_stride  = field.stride(0);
+        const DATA_TYPE* data      = field.data();
+        ATLAS_MAYBE_UNUSED size_t n = size_t(sendcnt) * size_t(var_size);
+        atlas_omp_pragma(omp parallel for schedule(static) if(n > detail::pack_omp_threshold))
         for (int node_cnt = 0; node_cnt < sendcnt; ++node_cnt) {
             const idx_t node_idx = sendmap[node_cnt];
-            halo_packer_impl<ParallelDim, RANK, 0>::apply(ibuf, node_idx, field, send_buffer);
+            idx_t ibuf           = node_cnt * var_size;
+            if (contiguous) {
+                detail::pack_strided(send_buffer + ibuf, data + node_idx * point_stride, var_size, 1);
+            }
+            else {
+                halo_packer_impl<ParallelDim, RANK, 0>::apply(ibuf, node_idx, field, send_buffer);
+            }
         }
     }
 
     template <typename DATA_TYPE>
-    static void unpack(const int recvcnt, array::SVector<int> const& recvmap, const DATA_TYPE* recv_buffer,
-                       int /*recv_buffer_size*/, array::ArrayView<DATA_TYPE, RANK>& field) {
-        idx_t ibuf = 0;
+    static void unpack(const int recvcnt, const int recvmap[], const DATA_TYPE* recv_buffer,
+                       array::ArrayView<DATA_TYPE, RANK>& field) {
+        const idx_t var_size        = halo_packer::var_size(field);
+        const bool contiguous       = contiguous_vars(field);
+        const size_t point_stride   = field.stride(0);
+        DATA_TYPE* data             = field.data();
+        ATLAS_MAYBE_UNUSED size_t n = size_t(recvcnt) * size_t(var_size);
+        atlas_omp_pragma(omp parallel for schedule(static) if(n > detail::pack_omp_threshold))
         for (int node_cnt = 0; node_cnt < recvcnt; ++node_cnt) {
             const idx_t node_idx = recvmap[node_cnt];
-            halo_unpacker_impl<ParallelDim, RANK, 0>::apply(ibuf, node_idx, recv_buffer, field);
+            idx_t ibuf           = node_cnt * var_size;
+            if (contiguous) {
+                detail::unpack_strided(recv_buffer + ibuf, data + node_idx * point_stride, var_size, 1);
+            }
+            else {
+                halo_unpacker_impl<ParallelDim, RANK, 0>::apply(ibuf, node_idx, recv_buffer, field);
+            }
         }
     }
+
+    template <typename DATA_TYPE>
+    static void pack(const int sendcnt, array::SVector<int> const& sendmap,
+                     const array::ArrayView<DATA_TYPE, RANK>& field, DATA_TYPE* send_buffer, int /*send_buffer_size*/) {
+        pack(sendcnt, sendmap.data(), field, send_buffer);
+    }
+
+    template <typename DATA_TYPE>
+    static void unpack(const int recvcnt, array::SVector<int> const& recvmap, const DATA_TYPE* recv_buffer,
+                       int /*recv_buffer_size*/, array::ArrayView<DATA_TYPE, RANK>& field) {
+        unpack(recvcnt, recvmap.data(), recv_buffer, field);
+    }
 };
 
 template <int ParallelDim, int RANK>
@@ -0,0 +1,67 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace atlas {
+namespace parallel {
+
+class HaloExchange;
+
+namespace detail {
+struct HaloExchangeArray;
+struct HaloExchangeBuffers;
+}  // namespace detail
+
+/// @brief State of a halo exchange with messages in flight
+///
+/// A handle is returned by HaloExchange::start(), which posts the receives and sends.
+/// HaloExchange::finish() waits for the messages and unpacks the halos. In between, the
+/// caller can do work that does not touch the halos of the exchanged arrays.
+///
+/// When several exchanges are in flight at the same time, all partitions must start them
+/// in the same order.
+///
+/// A handle that is destroyed, or assigned to, while still active waits for its messages to
+/// complete before its buffers are released, e.g. when an exception is thrown between start()
+/// and finish(). The halos are then not unpacked and the on_finish functions are not called.
+class HaloExchangeHandle {
+public:
+    HaloExchangeHandle();
+    HaloExchangeHandle(HaloExchangeHandle&&);
+    HaloExchangeHandle& operator=(HaloExchangeHandle&&);
+    HaloExchangeHandle(const HaloExchangeHandle&) = delete;
+    HaloExchangeHandle& operator=(const HaloExchangeHandle&) = delete;
+    ~HaloExchangeHandle();
+
+    /// @brief True between HaloExchange::start() and HaloExchange::finish()
+    bool active() const { return active_; }
+
+    /// @brief Register a function to be called at the end of HaloExchange::finish()
+    void on_finish(std::function<void()>&& f) { on_finish_.emplace_back(std::move(f)); }
+
+private:
+    friend class HaloExchange;
+
+    /// Wait for the messages of an unfinished exchange and release the buffers
+    void abandon();
+
+    bool active_{false};
+    std::vector<detail::HaloExchangeArray> arrays_;
+    std::shared_ptr<detail::HaloExchangeBuffers> buffers_;
+    std::vector<std::function<void()>> on_finish_;
+};
+
+}  // namespace parallel
+}  // namespace atlas
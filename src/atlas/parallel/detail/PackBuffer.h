@@ -0,0 +1,52 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <algorithm>
+
+#include "atlas/library/config.h"
+
+namespace atlas {
+namespace parallel {
+namespace detail {
+
+/// Minimum number of values to pack or unpack before the work is shared between OpenMP threads
+static constexpr size_t pack_omp_threshold = 16384;
+
+/// Copy n values with given source stride into a contiguous buffer
+template <typename DATA_TYPE>
+inline void pack_strided(DATA_TYPE* buffer, const DATA_TYPE* data, idx_t n, idx_t stride) {
+    if (stride == 1) {
+        std::copy(data, data + n, buffer);
+    }
+    else {
+        for (idx_t i = 0; i < n; ++i) {
+            buffer[i] = data[i * stride];
+        }
+    }
+}
+
+/// Copy n values from a contiguous buffer into data with given destination stride
+template <typename DATA_TYPE>
+inline void unpack_strided(const DATA_TYPE* buffer, DATA_TYPE* data, idx_t n, idx_t stride) {
+    if (stride == 1) {
+        std::copy(buffer, buffer + n, data);
+    }
+    else {
+        for (idx_t i = 0; i < n; ++i) {
+            data[i * stride] = buffer[i];
+        }
+    }
+}
+
+}  // namespace detail
+}  // namespace parallel
+}  // namespace atlas
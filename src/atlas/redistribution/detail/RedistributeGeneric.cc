@@ -5,6 +5,8 @@
  * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
  */
 
+#include <algorithm>
+#include <cstdint>
 #include <numeric>
 #include <vector>
 
@@ -128,92 +130,130 @@ std::vector<IdxUid> getUidVec(const FunctionSpace& functionspace) {
     return uidVec;
 }
 
-// Copy UID index
-std::vector<idx_t> getUidIdx(const std::vector<IdxUid>& uidVec) {
-    auto idxVec = std::vector<idx_t>{};
-    idxVec.reserve(uidVec.size());
-    std::transform(uidVec.begin(), uidVec.end(), std::back_inserter(idxVec),
-                   [](const IdxUid& uid) { return uid.first; });
-    return idxVec;
+// Rendezvous rank which matches source and target owners of a UID.
+// The bits are mixed so that contiguous ranges of UIDs are spread evenly over all ranks.
+int getRendezvousRank(uidx_t uid, size_t mpi_size) {
+    auto x = static_cast<std::uint64_t>(uid);
+    x      = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x      = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    x      = x ^ (x >> 31);
+    return static_cast<int>(x % static_cast<std::uint64_t>(mpi_size));
 }
 
-// Copy UID value
-std::vector<uidx_t> getUidVal(const std::vector<IdxUid>& uidVec) {
-    auto valVec = std::vector<uidx_t>{};
-    valVec.reserve(uidVec.size());
-    std::transform(uidVec.begin(), uidVec.end(), std::back_inserter(valVec),
-                   [](const IdxUid& uid) { return uid.second; });
-    return valVec;
-}
+// Send UIDs to their rendezvous ranks. On return, element i of the result
+// contains the UIDs owned by PE i which this PE is the rendezvous rank for.
+std::vector<std::vector<uidx_t>> communicateUidToRendezvous(const std::string& mpi_comm,
+                                                            const std::vector<IdxUid>& localUids) {
+    auto& comm    = mpi::comm(mpi_comm);
+    auto mpi_size = comm.size();
 
-// Communicate UID values, return receive buffer and displacements.
-std::pair<std::vector<uidx_t>, std::vector<int>> communicateUid(const std::string& mpi_comm, const std::vector<uidx_t>& sendBuffer) {
-    auto& comm = mpi::comm(mpi_comm);
-    auto counts = std::vector<int>(comm.size());
-    comm.allGather(static_cast<int>(sendBuffer.size()), counts.begin(), counts.end());
+    auto sendBuffers = std::vector<std::vector<uidx_t>>(mpi_size);
+    auto recvBuffers = std::vector<std::vector<uidx_t>>(mpi_size);
+    for (const auto& uid : localUids) {
+        sendBuffers[getRendezvousRank(uid.second, mpi_size)].push_back(uid.second);
+    }
+    comm.allToAll(sendBuffers, recvBuffers);
+    return recvBuffers;
+}
 
-    auto disps = std::vector<int>{};
-    disps.reserve(comm.size() + 1);
-    disps.push_back(0);
-    std::partial_sum(counts.begin(), counts.end(), std::back_inserter(disps));
+// List (UID, owner PE) pairs received by a rendezvous rank, sorted by UID.
+std::vector<std::pair<uidx_t, int>> getUidOwners(const std::vector<std::vector<uidx_t>>& uidsPerPe) {
+    auto uidOwners = std::vector<std::pair<uidx_t, int>>{};
+    for (size_t i = 0; i < uidsPerPe.size(); ++i) {
+        for (const auto& uid : uidsPerPe[i]) {
+            uidOwners.emplace_back(uid, static_cast<int>(i));
+        }
+    }
+    std::sort(uidOwners.begin(), uidOwners.end());
+    return uidOwners;
+}
 
+// Match source and target owners of the UIDs held by this rendezvous rank,
+// then return to every owner the (UID, PE) pairs it has to exchange.
+std::pair<std::vector<std::vector<uidx_t>>, std::vector<std::vector<uidx_t>>> matchUidOwners(
+    const std::string& mpi_comm, const std::vector<std::vector<uidx_t>>& sourceUidsPerPe,
+    const std::vector<std::vector<uidx_t>>& targetUidsPerPe) {
+    auto& comm    = mpi::comm(mpi_comm);
+    auto mpi_size = comm.size();
 
-    auto recvBuffer = std::vector<uidx_t>(static_cast<size_t>(disps.back()));
+    const auto sourceOwners = getUidOwners(sourceUidsPerPe);
+    const auto targetOwners = getUidOwners(targetUidsPerPe);
+
+    // Walk both sorted lists and pair up source and target owners of each UID.
+    auto sourceReply = std::vector<std::vector<uidx_t>>(mpi_size);
+    auto targetReply = std::vector<std::vector<uidx_t>>(mpi_size);
+    size_t nbMatches = 0;
+    auto sourceIt    = sourceOwners.begin();
+    auto targetIt    = targetOwners.begin();
+    while (sourceIt != sourceOwners.end() && targetIt != targetOwners.end()) {
+        if (sourceIt->first < targetIt->first) {
+            ++sourceIt;
+        }
+        else if (targetIt->first < sourceIt->first) {
+            ++targetIt;
+        }
+        else {
+            const auto uid = sourceIt->first;
+            sourceReply[sourceIt->second].push_back(uid);
+            sourceReply[sourceIt->second].push_back(static_cast<uidx_t>(targetIt->second));
+            targetReply[targetIt->second].push_back(uid);
+            targetReply[targetIt->second].push_back(static_cast<uidx_t>(sourceIt->second));
+            ++nbMatches;
+            ++sourceIt;
+            ++targetIt;
+        }
+    }
 
-    comm.allGatherv(sendBuffer.begin(), sendBuffer.end(), recvBuffer.begin(), counts.data(), disps.data());
+    // Check that every source and target UID has been matched.
+    if (ATLAS_BUILD_TYPE_DEBUG) {
+        ATLAS_ASSERT(nbMatches == sourceOwners.size() && nbMatches == targetOwners.size(),
+                     "Source and target UID sets do not match.");
+    }
 
-    return std::make_pair(recvBuffer, disps);
+    // Return matches to owners.
+    auto sourceMatches = std::vector<std::vector<uidx_t>>(mpi_size);
+    auto targetMatches = std::vector<std::vector<uidx_t>>(mpi_size);
+    comm.allToAll(sourceReply, sourceMatches);
+    comm.allToAll(targetReply, targetMatches);
+    return std::make_pair(sourceMatches, targetMatches);
 }
 
-// Need to overload "<" operator for comparison of asymmetric types in
-// std::set_intersection.
-bool operator<(const IdxUid& lhs, const uidx_t& rhs) {
-    return lhs.second < rhs;
-}
-bool operator<(const uidx_t& lhs, const IdxUid& rhs) {
-    return lhs < rhs.second;
-}
+// Convert (UID, PE) pairs received from the rendezvous ranks into local indices
+// grouped by PE, then return local indices and PE displacements in vector.
+// Within each PE, indices are ordered by UID so that both sides of an exchange agree.
+std::pair<std::vector<idx_t>, std::vector<int>> getUidExchange(const std::string& mpi_comm,
+                                                               const std::vector<IdxUid>& localUids,
+                                                               const std::vector<std::vector<uidx_t>>& matches) {
+    auto& comm    = mpi::comm(mpi_comm);
+    auto mpi_size = comm.size();
 
-// Find the intersection between local and global UIDs, then return local
-// indices of incections and PE dispacements in vector.
-std::pair<std::vector<idx_t>, std::vector<int>> getUidIntersection(const std::string& mpi_comm,
-                                                                   const std::vector<IdxUid>& localUids,
-                                                                   const std::vector<uidx_t>& globalUids,
-                                                                   const std::vector<int>& globalDisps) {
-    auto uidIntersection = std::vector<IdxUid>{};
-    uidIntersection.reserve(localUids.size());
+    auto uidsPerPe = std::vector<std::vector<IdxUid>>(mpi_size);
+    for (const auto& rendezvousMatches : matches) {
+        for (size_t i = 0; i < rendezvousMatches.size(); i += 2) {
+            const auto uid = rendezvousMatches[i];
+            const auto pe  = static_cast<size_t>(rendezvousMatches[i + 1]);
+            const auto it  = std::lower_bound(localUids.begin(), localUids.end(), uid,
+                                              [](const IdxUid& a, const uidx_t& b) { return a.second < b; });
+            ATLAS_ASSERT(it != localUids.end() && it->second == uid);
+            uidsPerPe[pe].push_back(*it);
+        }
+    }
 
-    auto& comm = mpi::comm(mpi_comm);
-    auto mpi_size = comm.size();
+    auto idxVec = std::vector<idx_t>{};
+    idxVec.reserve(localUids.size());
 
     auto disps = std::vector<int>{};
     disps.reserve(mpi_size + 1);
     disps.push_back(0);
 
-    // Loop over all PE and find UID intersection.
-    for (size_t i = 0; i < mpi_size; ++i) {
-        // Get displaced iterators.
-        auto globalUidsBegin = globalUids.begin() + globalDisps[i];
-        auto globalUidsEnd   = globalUids.begin() + globalDisps[i + 1];
-
-        // Get intersection.
-        std::set_intersection(localUids.begin(), localUids.end(), globalUidsBegin, globalUidsEnd,
-                              std::back_inserter(uidIntersection));
-
-        // Set intersection displacement.
-        disps.push_back(static_cast<int>(uidIntersection.size()));
+    for (auto& uids : uidsPerPe) {
+        std::sort(uids.begin(), uids.end(), [](const IdxUid& a, const IdxUid& b) { return a.second < b.second; });
+        std::transform(uids.begin(), uids.end(), std::back_inserter(idxVec),
+                       [](const IdxUid& uid) { return uid.first; });
+        disps.push_back(static_cast<int>(idxVec.size()));
     }
 
-    // Check that the set of all intersections matches UIDs on local PE.
-    if (ATLAS_BUILD_TYPE_DEBUG) {
-        auto tempUids = uidIntersection;
-        std::sort(tempUids.begin(), tempUids.end(),
-                  [](const IdxUid& a, const IdxUid& b) { return a.second < b.second; });
-        ATLAS_ASSERT(tempUids == localUids, "Set of all UID intersections does not match local UIDs.");
-    }
-
-    // Return local indices of intersection and displacements.
-    return make_pair(getUidIdx(uidIntersection), disps);
+    return make_pair(idxVec, disps);
 }
 
 
@@ -268,17 +308,18 @@ void RedistributeGeneric::do_setup() {
     const auto sourceUidVec = getUidVec(source());
     const auto targetUidVec = getUidVec(target());
 
-    // Communicate UID vectors to all PEs.
-    auto sourceGlobalUids                         = std::vector<uidx_t>{};
-    auto sourceGlobalDisps                        = std::vector<int>{};
-    std::tie(sourceGlobalUids, sourceGlobalDisps) = communicateUid(mpi_comm_, getUidVal(sourceUidVec));
-    auto targetGlobalUids                         = std::vector<uidx_t>{};
-    auto targetGlobalDisps                        = std::vector<int>{};
-    std::tie(targetGlobalUids, targetGlobalDisps) = communicateUid(mpi_comm_, getUidVal(targetUidVec));
-
-    // Get intersection of local UIDs and Global UIDs.
-    std::tie(sourceLocalIdx_, sourceDisps_) = getUidIntersection(mpi_comm_, sourceUidVec, targetGlobalUids, targetGlobalDisps);
-    std::tie(targetLocalIdx_, targetDisps_) = getUidIntersection(mpi_comm_, targetUidVec, sourceGlobalUids, sourceGlobalDisps);
+    // Send UIDs to rendezvous ranks, where source and target owners are matched.
+    // This keeps memory and communication volume per PE proportional to the local size.
+    const auto sourceUidsPerPe = communicateUidToRendezvous(mpi_comm_, sourceUidVec);
+    const auto targetUidsPerPe = communicateUidToRendezvous(mpi_comm_, targetUidVec);
+
+    auto sourceMatches                     = std::vector<std::vector<uidx_t>>{};
+    auto targetMatches                     = std::vector<std::vector<uidx_t>>{};
+    std::tie(sourceMatches, targetMatches) = matchUidOwners(mpi_comm_, sourceUidsPerPe, targetUidsPerPe);
+
+    // Get local indices to exchange with each PE.
+    std::tie(sourceLocalIdx_, sourceDisps_) = getUidExchange(mpi_comm_, sourceUidVec, sourceMatches);
+    std::tie(targetLocalIdx_, targetDisps_) = getUidExchange(mpi_comm_, targetUidVec, targetMatches);
 }
 
 void RedistributeGeneric::execute(const Field& sourceField, Field& targetField) const {
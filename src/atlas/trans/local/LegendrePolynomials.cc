@@ -159,6 +159,25 @@ void compute_legendre_polynomials(
     double leg_asym[],        // values of associated Legendre functions, asymmetric part
     size_t leg_start_sym[],   // start indices for different zonal wave numbers, symmetric part
     size_t leg_start_asym[])  // start indices for different zonal wave numbers, asymmetric part
+{
+    std::vector<int> zonal_wavenumbers(truncation + 1);
+    for (int jm = 0; jm <= truncation; ++jm) {
+        zonal_wavenumbers[jm] = jm;
+    }
+    compute_legendre_polynomials(truncation, nlats, lats, truncation + 1, zonal_wavenumbers.data(), leg_sym, leg_asym,
+                                 leg_start_sym, leg_start_asym);
+}
+
+void compute_legendre_polynomials(
+    const int truncation,            // truncation (in)
+    const int nlats,                 // number of latitudes
+    const double lats[],             // latitudes in radians (in)
+    const int nb_zonal_wavenumbers,  // number of zonal wave numbers to store
+    const int zonal_wavenumbers[],   // zonal wave numbers to store
+    double leg_sym[],                // values of associated Legendre functions, symmetric part
+    double leg_asym[],               // values of associated Legendre functions, asymmetric part
+    size_t leg_start_sym[],          // start indices for different zonal wave numbers, symmetric part
+    size_t leg_start_asym[])         // start indices for different zonal wave numbers, asymmetric part
 {
     size_t trc           = static_cast<size_t>(truncation);
     size_t legendre_size = (trc + 2) * (trc + 1) / 2;
@@ -176,7 +195,8 @@ void compute_legendre_polynomials(
         {
             //ATLAS_TRACE( "add to global arrays" );
 
-            for (size_t jm = 0; jm <= trc; jm++) {
+            for (int jml = 0; jml < nb_zonal_wavenumbers; jml++) {
+                size_t jm  = static_cast<size_t>(zonal_wavenumbers[jml]);
                 size_t is1 = 0, ia1 = 0;
                 for (size_t jn = jm; jn <= trc; jn++) {
                     (jn - jm) % 2 ? ia1++ : is1++;
@@ -48,6 +48,18 @@ void compute_legendre_polynomials(
     size_t leg_start_sym[],    // start indices for different zonal wave numbers, symmetric part
     size_t leg_start_asym[]);  // start indices for different zonal wave numbers, asymmetric part
 
+// Same, but only stores the given zonal wave numbers; leg_start_sym and leg_start_asym are only accessed for these.
+void compute_legendre_polynomials(
+    const int trc,                   // truncation (in)
+    const int nlats,                 // number of latitudes
+    const double lats[],             // latitudes in radians (in)
+    const int nb_zonal_wavenumbers,  // number of zonal wave numbers to store
+    const int zonal_wavenumbers[],   // zonal wave numbers to store, each <= trc
+    double legendre_sym[],           // values of associated Legendre functions, symmetric part
+    double legendre_asym[],          // values of associated Legendre functions, asymmetric part
+    size_t leg_start_sym[],          // start indices for different zonal wave numbers, symmetric part
+    size_t leg_start_asym[]);        // start indices for different zonal wave numbers, asymmetric part
+
 void compute_legendre_polynomials_all(const int trc,        // truncation (in)
                                       const int nlats,      // number of latitudes
                                       const double lats[],  // latitudes in radians (in)
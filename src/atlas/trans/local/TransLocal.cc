@@ -10,9 +10,13 @@
 
 #include "atlas/trans/local/TransLocal.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstdlib>
+#include <exception>
 #include <fstream>
+#include <type_traits>
 
 #include "atlas/linalg/dense.h"
 #include "eckit/config/YAMLConfiguration.h"
@@ -27,8 +31,10 @@
 #include "atlas/field.h"
 #include "atlas/grid/Iterator.h"
 #include "atlas/grid/StructuredGrid.h"
+#include "atlas/grid/detail/distribution/DistributionRunLength.h"
 #include "atlas/option.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/trans/Trans.h"
@@ -36,6 +42,7 @@
 #include "atlas/trans/detail/TransFactory.h"
 #include "atlas/trans/local/LegendrePolynomials.h"
 #include "atlas/util/Constants.h"
+#include "atlas/util/GaussianLatitudes.h"
 
 #include "atlas/library/defines.h"
 #if ATLAS_HAVE_FFTW
@@ -97,6 +104,8 @@ public:
 
     std::string matrix_multiply() const { return config_.getString("matrix_multiply", ""); }
 
+    std::string precision() const { return config_.getString("precision", "double"); }
+
 
 private:
     const eckit::Configuration& config_;
@@ -186,27 +195,31 @@ size_t num_n(const int truncation, const int m, const bool symmetric) {
 }
 
 
-void alloc_aligned(double*& ptr, size_t n) {
+template <typename Value>
+void alloc_aligned(Value*& ptr, size_t n) {
     const size_t alignment = 64 * sizeof(double);
-    size_t bytes           = sizeof(double) * n;
+    size_t bytes           = sizeof(Value) * n;
     int err                = posix_memalign((void**)&ptr, alignment, bytes);
     if (err) {
         throw_AllocationFailed(bytes, Here());
     }
 }
 
-void free_aligned(double*& ptr) {
+template <typename Value>
+void free_aligned(Value*& ptr) {
     free(ptr);
     ptr = nullptr;
 }
 
-void alloc_aligned(double*& ptr, size_t n, const char* msg) {
+template <typename Value>
+void alloc_aligned(Value*& ptr, size_t n, const char* msg) {
     ATLAS_ASSERT(msg);
-    Log::debug() << "TransLocal: allocating '" << msg << "': " << eckit::Bytes(sizeof(double) * n) << std::endl;
+    Log::debug() << "TransLocal: allocating '" << msg << "': " << eckit::Bytes(sizeof(Value) * n) << std::endl;
     alloc_aligned(ptr, n);
 }
 
-void free_aligned(double*& ptr, const char* msg) {
+template <typename Value>
+void free_aligned(Value*& ptr, const char* msg) {
     ATLAS_ASSERT(msg);
     Log::debug() << "TransLocal: deallocating '" << msg << "'" << std::endl;
     free_aligned(ptr);
@@ -216,6 +229,18 @@ size_t add_padding(size_t n) {
     return size_t(std::ceil(n / 8.)) * 8;
 }
 
+// C = A * B, with column-major matrices A (m x k), B (k x n) and C (m x n)
+void gemm(const double A[], const double B[], double C[], int m, int n, int k, const linalg::dense::Backend& backend) {
+    linalg::Matrix mA(const_cast<double*>(A), m, k);
+    linalg::Matrix mB(const_cast<double*>(B), k, n);
+    linalg::Matrix mC(C, m, n);
+    linalg::matrix_multiply(mA, mB, mC, backend);
+}
+
+void gemm(const float A[], const float B[], float C[], int m, int n, int k, const linalg::dense::Backend& backend) {
+    linalg::dense::sgemm(A, B, C, m, n, k, backend);
+}
+
 std::string detect_linalg_backend(const std::string& linalg_backend_) {
     linalg::dense::Backend linalg_backend = linalg::dense::Backend{linalg_backend_};
     if (linalg_backend.type() == linalg::dense::backend::eckit_linalg::type()) {
@@ -233,6 +258,56 @@ std::string detect_linalg_backend(const std::string& linalg_backend_) {
     return linalg_backend.type();
 };
 
+// GEMM backends with a thread pool of their own, which would oversubscribe the cores when called
+// from the threaded loop over zonal wavenumbers
+bool threaded_linalg_backend(const std::string& linalg_backend_) {
+    return detect_linalg_backend(linalg_backend_) == "mkl";
+}
+
+// Disables nested OpenMP parallelism within its scope, so that OpenMP-threaded GEMM backends
+// run on a single thread when called from within a parallel region
+class SerialNestedParallelism {
+public:
+    SerialNestedParallelism(): nested_(atlas_omp_get_nested()) { atlas_omp_set_nested(0); }
+    ~SerialNestedParallelism() { atlas_omp_set_nested(nested_); }
+
+private:
+    int nested_;
+};
+
+// Keeps exceptions from leaving an OpenMP parallel region, where they would terminate the program. The first
+// exception thrown by any thread is stored, and rethrown by rethrow() after the region.
+class ParallelExceptions {
+public:
+    template <typename Function>
+    void run(const Function& f) noexcept {
+        if (failed_) {
+            return;
+        }
+        try {
+            f();
+        }
+        catch (...) {
+            atlas_omp_critical {
+                if (not exception_) {
+                    exception_ = std::current_exception();
+                }
+            }
+            failed_ = true;
+        }
+    }
+
+    void rethrow() const {
+        if (exception_) {
+            std::rethrow_exception(exception_);
+        }
+    }
+
+private:
+    std::atomic<bool> failed_{false};
+    std::exception_ptr exception_;
+};
+
 bool using_eckit_default_backend(const std::string& linalg_backend_) {
     linalg::dense::Backend linalg_backend = linalg::dense::Backend{linalg_backend_};
     if (linalg_backend.type() == linalg::dense::backend::eckit_linalg::type()) {
@@ -284,8 +359,38 @@ struct FFTW_Data {
     fftw_complex* in;
     double* out;
     std::vector<fftw_plan> plans;
+    std::vector<fftw_plan> plans_dir;  // real-to-complex plans for the direct transform
+#endif
+#if ATLAS_HAVE_FFTW_SINGLE
+    // single precision buffers and complex-to-real plans, created with the single precision coefficients
+    fftwf_complex* in_f{nullptr};
+    float* out_f{nullptr};
+    std::vector<fftwf_plan> plans_f;
 #endif
 };
+
+#if ATLAS_HAVE_FFTW
+// Buffers and complex-to-real plans of the inverse FFT in the precision of the transformed data
+template <typename Value>
+struct FFTW_Inverse {
+    FFTW_Inverse(FFTW_Data& data): in(data.in), out(data.out), plans(data.plans) {}
+    void execute(int jplan) const { fftw_execute_dft_c2r(plans[jplan], in, out); }
+    fftw_complex* in;
+    double* out;
+    const std::vector<fftw_plan>& plans;
+};
+
+#if ATLAS_HAVE_FFTW_SINGLE
+template <>
+struct FFTW_Inverse<float> {
+    FFTW_Inverse(FFTW_Data& data): in(data.in_f), out(data.out_f), plans(data.plans_f) {}
+    void execute(int jplan) const { fftwf_execute_dft_c2r(plans[jplan], in, out); }
+    fftwf_complex* in;
+    float* out;
+    const std::vector<fftwf_plan>& plans;
+};
+#endif
+#endif
 }  // namespace detail
 
 
@@ -311,12 +416,18 @@ TransLocal::TransLocal(const Cache& cache, const Grid& grid, const Domain& domai
     fft_cachesize_(cache.fft().size()),
     fftw_(new detail::FFTW_Data),
     linalg_backend_(TransParameters{config}.matrix_multiply()),
-    warning_(TransParameters{config}.warning()) {
+    warning_(TransParameters{config}.warning()),
+    mpi_comm_(config.getString("mpi_comm", mpi::comm().name())) {
     ATLAS_TRACE("TransLocal constructor");
 
-    if (mpi::size() > 1) {
-        ATLAS_THROW_EXCEPTION("TransLocal is not implemented for more than 1 MPI task.");
+    if (mpi::comm(mpi_comm_).size() > 1) {
+        if (not(StructuredGrid(grid_) && not grid_.projection() && grid_.domain().global())) {
+            ATLAS_THROW_EXCEPTION(
+                "TransLocal is only implemented for more than 1 MPI task with global structured grids.");
+        }
+        distributed_ = true;
     }
+    setup_distribution();
 
     double fft_threshold = 0.0;  // fraction of latitudes of the full grid down to which FFT is used.
     // This threshold needs to be adjusted depending on the dgemm and FFT performance of the machine
@@ -563,9 +674,24 @@ TransLocal::TransLocal(const Cache& cache, const Grid& grid, const Domain& domai
             legendre_asym_begin_.resize(truncation_ + 3);
             legendre_sym_begin_[0]  = 0;
             legendre_asym_begin_[0] = 0;
+
+            // When distributed, only the local zonal wavenumbers are stored, unless the coefficients are
+            // read from or written to a Legendre cache, which holds all zonal wavenumbers.
+            const bool local_legendre = distributed_ && not legendre_cache_ &&
+                                        not TransParameters(config).export_legendre() &&
+                                        TransParameters(config).write_legendre().empty();
+            std::vector<bool> store_m(truncation_ + 2, true);
+            if (local_legendre) {
+                store_m.assign(truncation_ + 2, false);
+                for (int jm : nmyms_) {
+                    store_m[jm] = true;
+                }
+            }
             for (idx_t jm = 0; jm <= truncation_ + 1; jm++) {
-                size_sym += add_padding(num_n(truncation_ + 1, jm, /*symmetric*/ true) * nlatsLeg);
-                size_asym += add_padding(num_n(truncation_ + 1, jm, /*symmetric*/ false) * nlatsLeg);
+                if (store_m[jm]) {
+                    size_sym += add_padding(num_n(truncation_ + 1, jm, /*symmetric*/ true) * nlatsLeg);
+                    size_asym += add_padding(num_n(truncation_ + 1, jm, /*symmetric*/ false) * nlatsLeg);
+                }
                 legendre_sym_begin_[jm + 1]  = size_sym;
                 legendre_asym_begin_[jm + 1] = size_asym;
             }
@@ -597,8 +723,16 @@ TransLocal::TransLocal(const Cache& cache, const Grid& grid, const Domain& domai
                 }
 
                 ATLAS_TRACE_SCOPE("Legendre precomputations (structured)") {
-                    compute_legendre_polynomials(truncation_ + 1, nlatsLeg_, lats.data(), legendre_sym_, legendre_asym_,
-                                                 legendre_sym_begin_.data(), legendre_asym_begin_.data());
+                    if (local_legendre) {
+                        compute_legendre_polynomials(truncation_ + 1, nlatsLeg_, lats.data(),
+                                                     static_cast<int>(nmyms_.size()), nmyms_.data(), legendre_sym_, legendre_asym_,
+                                                     legendre_sym_begin_.data(), legendre_asym_begin_.data());
+                    }
+                    else {
+                        compute_legendre_polynomials(truncation_ + 1, nlatsLeg_, lats.data(), legendre_sym_,
+                                                     legendre_asym_, legendre_sym_begin_.data(),
+                                                     legendre_asym_begin_.data());
+                    }
                 }
                 std::string file_path = TransParameters(config).write_legendre();
                 if (file_path.size()) {
@@ -613,14 +747,32 @@ TransLocal::TransLocal(const Cache& cache, const Grid& grid, const Domain& domai
             }
         }
 
+        // quadrature weights for direct transforms, only exact on global Gaussian grids:
+        if (GaussianGrid(grid_) && grid_.domain().global()) {
+            idx_t N = GaussianGrid(grid_).N();
+            ATLAS_ASSERT(nlatsLeg_ == N && nlatsNH_ == N && nlatsSH_ == N);
+            std::vector<double> lats_quadrature(N);
+            quadrature_weights_.resize(N);
+            util::gaussian_quadrature_npole_equator(N, lats_quadrature.data(), quadrature_weights_.data());
+            // normalise such that the weights of both hemispheres sum up to one
+            double sum = 0.;
+            for (idx_t j = 0; j < N; ++j) {
+                sum += quadrature_weights_[j];
+            }
+            for (idx_t j = 0; j < N; ++j) {
+                quadrature_weights_[j] *= 0.5 / sum;
+            }
+        }
+
         // precomputations for Fourier transformations:
         if (useFFT_) {
 #if ATLAS_HAVE_FFTW && !TRANSLOCAL_DGEMM2
             {
                 ATLAS_TRACE("Fourier precomputations (FFTW)");
                 int num_complex = (nlonsMaxGlobal_ / 2) + 1;
-                fftw_->in       = fftw_alloc_complex(nlats * num_complex);
-                fftw_->out      = fftw_alloc_real(nlats * nlonsMaxGlobal_);
+                int nlats_fft   = std::max<int>(nlats_local_, 1);  // only local latitudes are Fourier transformed
+                fftw_->in       = fftw_alloc_complex(nlats_fft * num_complex);
+                fftw_->out      = fftw_alloc_real(nlats_fft * nlonsMaxGlobal_);
 
                 if (fft_cache_) {
                     Log::debug() << "Import FFTW wisdom from cache" << std::endl;
@@ -641,8 +793,14 @@ TransLocal::TransLocal(const Cache& cache, const Grid& grid, const Domain& domai
                 if (RegularGrid(gridGlobal_)) {
                     fftw_->plans.resize(1);
                     fftw_->plans[0] =
-                        fftw_plan_many_dft_c2r(1, &nlonsMaxGlobal_, nlats, fftw_->in, nullptr, 1, num_complex,
+                        fftw_plan_many_dft_c2r(1, &nlonsMaxGlobal_, nlats_fft, fftw_->in, nullptr, 1, num_complex,
                                                fftw_->out, nullptr, 1, nlonsMaxGlobal_, FFTW_ESTIMATE);
+                    if (quadrature_weights_.size()) {
+                        fftw_->plans_dir.resize(1);
+                        fftw_->plans_dir[0] =
+                            fftw_plan_many_dft_r2c(1, &nlonsMaxGlobal_, nlats_fft, fftw_->out, nullptr, 1,
+                                                   nlonsMaxGlobal_, fftw_->in, nullptr, 1, num_complex, FFTW_ESTIMATE);
+                    }
                 }
                 else {
                     fftw_->plans.resize(nlatsLegDomain_);
@@ -651,6 +809,14 @@ TransLocal::TransLocal(const Cache& cache, const Grid& grid, const Domain& domai
                         //ASSERT( nlonsGlobalj > 0 && nlonsGlobalj <= nlonsMaxGlobal_ );
                         fftw_->plans[j] = fftw_plan_dft_c2r_1d(nlonsGlobalj, fftw_->in, fftw_->out, FFTW_ESTIMATE);
                     }
+                    if (quadrature_weights_.size()) {
+                        fftw_->plans_dir.resize(nlatsLegDomain_);
+                        for (int j = 0; j < nlatsLegDomain_; j++) {
+                            int nlonsGlobalj = gs_global.nx(jlatMinLeg_ + j);
+                            fftw_->plans_dir[j] =
+                                fftw_plan_dft_r2c_1d(nlonsGlobalj, fftw_->out, fftw_->in, FFTW_ESTIMATE);
+                        }
+                    }
                 }
                 std::string file_path = TransParameters(config).write_fft();
                 if (file_path.size()) {
@@ -723,6 +889,24 @@ TransLocal::TransLocal(const Cache& cache, const Grid& grid, const Domain& domai
             }
 #endif
         }
+
+        if (TransParameters(config).precision() == "single") {
+            // Only the single precision coefficients are kept
+            setup_single_precision();
+            if (not legendre_cache_) {
+                free_aligned(legendre_sym_, "symmetric");
+                free_aligned(legendre_asym_, "asymmetric");
+            }
+            if (not useFFT_) {
+                free_aligned(fourier_, "Fourier coeffs.");
+            }
+            single_precision_only_ = true;
+        }
+        else if (TransParameters(config).precision() != "double") {
+            throw_Exception("TransLocal: unsupported precision \"" + TransParameters(config).precision() +
+                                "\", expected \"double\" or \"single\"",
+                            Here());
+        }
     }
     else {
         // unstructured grid
@@ -771,6 +955,13 @@ TransLocal::TransLocal(const Cache& cache, const Grid& grid, const long truncati
 // --------------------------------------------------------------------------------------------------------------------
 
 TransLocal::~TransLocal() {
+    if (legendre_sym_f_) {
+        free_aligned(legendre_sym_f_, "symmetric (float)");
+        free_aligned(legendre_asym_f_, "asymmetric (float)");
+    }
+    if (fourier_f_) {
+        free_aligned(fourier_f_, "Fourier coeffs. (float)");
+    }
     if (StructuredGrid(grid_) && not grid_.projection()) {
         if (not legendre_cache_) {
             free_aligned(legendre_sym_, "symmetric");
@@ -781,8 +972,20 @@ TransLocal::~TransLocal() {
             for (idx_t j = 0, size = static_cast<idx_t>(fftw_->plans.size()); j < size; j++) {
                 fftw_destroy_plan(fftw_->plans[j]);
             }
+            for (idx_t j = 0, size = static_cast<idx_t>(fftw_->plans_dir.size()); j < size; j++) {
+                fftw_destroy_plan(fftw_->plans_dir[j]);
+            }
             fftw_free(fftw_->in);
             fftw_free(fftw_->out);
+#endif
+#if ATLAS_HAVE_FFTW_SINGLE && !TRANSLOCAL_DGEMM2
+            for (auto& plan : fftw_->plans_f) {
+                fftwf_destroy_plan(plan);
+            }
+            if (fftw_->in_f) {
+                fftwf_free(fftw_->in_f);
+                fftwf_free(fftw_->out_f);
+            }
 #endif
         }
         else {
@@ -798,6 +1001,262 @@ TransLocal::~TransLocal() {
 
 // --------------------------------------------------------------------------------------------------------------------
 
+void TransLocal::legendre_coefficients(const double*& legendre_sym, const double*& legendre_asym) const {
+    legendre_sym  = legendre_sym_;
+    legendre_asym = legendre_asym_;
+}
+
+void TransLocal::legendre_coefficients(const float*& legendre_sym, const float*& legendre_asym) const {
+    setup_single_precision();
+    legendre_sym  = legendre_sym_f_;
+    legendre_asym = legendre_asym_f_;
+}
+
+void TransLocal::fourier_coefficients(const double*& fourier) const {
+    fourier = fourier_;
+}
+
+void TransLocal::fourier_coefficients(const float*& fourier) const {
+    setup_single_precision();
+    fourier = fourier_f_;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+void TransLocal::check_double_precision() const {
+    if (single_precision_only_) {
+        throw_Exception("TransLocal: double precision transforms are not available as the TransLocal was set up with "
+                        "\"precision\": \"single\"",
+                        Here());
+    }
+}
+
+void TransLocal::setup_single_precision() const {
+    std::call_once(single_precision_once_, [this]() {
+        ATLAS_TRACE("TransLocal: single precision precomputations");
+        // Converted from the double precision coefficients, which are computed (or read from cache) in any case.
+        // With "precision": "single", this happens in the constructor, which then frees the double precision ones.
+        const size_t size_sym  = legendre_sym_begin_.back();
+        const size_t size_asym = legendre_asym_begin_.back();
+        alloc_aligned(legendre_sym_f_, size_sym, "Legendre coeffs symmetric (float)");
+        alloc_aligned(legendre_asym_f_, size_asym, "Legendre coeffs asymmetric (float)");
+        std::copy(legendre_sym_, legendre_sym_ + size_sym, legendre_sym_f_);
+        std::copy(legendre_asym_, legendre_asym_ + size_asym, legendre_asym_f_);
+        if (not useFFT_) {
+            const size_t size_fourier = 2 * (truncation_ + 1) * StructuredGrid(grid_).nxmax();
+            alloc_aligned(fourier_f_, size_fourier, "Fourier coeffs (float)");
+            std::copy(fourier_, fourier_ + size_fourier, fourier_f_);
+        }
+#if ATLAS_HAVE_FFTW_SINGLE && !TRANSLOCAL_DGEMM2
+        if (useFFT_) {
+            // Same plans as the double precision complex-to-real plans of the constructor
+            int num_complex = (nlonsMaxGlobal_ / 2) + 1;
+            int nlats_fft   = std::max<int>(nlats_local_, 1);
+            fftw_->in_f     = fftwf_alloc_complex(nlats_fft * num_complex);
+            fftw_->out_f    = fftwf_alloc_real(nlats_fft * nlonsMaxGlobal_);
+            if (RegularGrid(gridGlobal_)) {
+                fftw_->plans_f.resize(1);
+                fftw_->plans_f[0] =
+                    fftwf_plan_many_dft_c2r(1, &nlonsMaxGlobal_, nlats_fft, fftw_->in_f, nullptr, 1, num_complex,
+                                            fftw_->out_f, nullptr, 1, nlonsMaxGlobal_, FFTW_ESTIMATE);
+            }
+            else {
+                StructuredGrid gs_global(gridGlobal_);
+                fftw_->plans_f.resize(nlatsLegDomain_);
+                for (int j = 0; j < nlatsLegDomain_; j++) {
+                    int nlonsGlobalj  = gs_global.nx(jlatMinLeg_ + j);
+                    fftw_->plans_f[j] = fftwf_plan_dft_c2r_1d(nlonsGlobalj, fftw_->in_f, fftw_->out_f, FFTW_ESTIMATE);
+                }
+            }
+        }
+#endif
+    });
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+void TransLocal::setup_distribution() {
+    const auto& comm   = mpi::comm(mpi_comm_);
+    const int nb_parts = distributed_ ? static_cast<int>(comm.size()) : 1;
+    const int part     = distributed_ ? static_cast<int>(comm.rank()) : 0;
+
+    // Zonal wavenumbers are dealt out in zigzag order (0, 1, ..., P-1, P-1, ..., 1, 0, 0, 1, ...),
+    // which balances the decreasing number of total wavenumbers for increasing m.
+    m_part_.resize(truncation_ + 1);
+    nmyms_.clear();
+    spectral_begin_.assign(1, 0);
+    for (int jm = 0; jm <= truncation_; ++jm) {
+        int cycle   = jm / nb_parts;
+        int pos     = jm % nb_parts;
+        m_part_[jm] = (cycle % 2 == 0) ? pos : nb_parts - 1 - pos;
+        if (m_part_[jm] == part) {
+            nmyms_.emplace_back(jm);
+            spectral_begin_.emplace_back(spectral_begin_.back() + 2 * (truncation_ + 1 - jm));
+        }
+    }
+
+    // Grid points are divided in bands of whole latitudes with approximately equal number of points
+    nb_gridpoints_local_ = grid_.size();
+    if (StructuredGrid(grid_) && not grid_.projection()) {
+        StructuredGrid g(grid_);
+        const idx_t nlats = g.ny();
+        const gidx_t npts = g.size();
+        gidx_t offset     = 0;
+        lat_begin_.assign(nb_parts + 1, 0);
+        for (idx_t jlat = 0; jlat < nlats; ++jlat) {
+            int p = static_cast<int>(((offset + g.nx(jlat) / 2) * nb_parts) / npts);
+            lat_begin_[std::min(p, nb_parts - 1) + 1]++;
+            offset += g.nx(jlat);
+        }
+        for (int p = 0; p < nb_parts; ++p) {
+            lat_begin_[p + 1] += lat_begin_[p];
+        }
+        jlat_begin_          = lat_begin_[part];
+        nlats_local_         = lat_begin_[part + 1] - lat_begin_[part];
+        nb_gridpoints_local_ = 0;
+        for (idx_t jlat = jlat_begin_; jlat < jlat_begin_ + nlats_local_; ++jlat) {
+            nb_gridpoints_local_ += g.nx(jlat);
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+grid::Distribution TransLocal::distribution() const {
+    ATLAS_ASSERT(not lat_begin_.empty(), "TransLocal::distribution() requires a structured grid");
+    StructuredGrid g(grid_);
+    const int nb_parts = static_cast<int>(lat_begin_.size()) - 1;
+    // One run of consecutive global indices per latitude band
+    std::vector<gidx_t> run_begin(nb_parts);
+    std::vector<int> run_part(nb_parts);
+    gidx_t n = 0;
+    for (int p = 0; p < nb_parts; ++p) {
+        run_begin[p] = n;
+        run_part[p]  = p;
+        for (idx_t jlat = lat_begin_[p]; jlat < lat_begin_[p + 1]; ++jlat) {
+            n += g.nx(jlat);
+        }
+    }
+    return grid::Distribution(new grid::detail::distribution::DistributionRunLength(
+        nb_parts, g.size(), std::move(run_begin), std::move(run_part)));
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename Value>
+void TransLocal::transpose_legendre_to_fourier(const int nlats, const int nb_fields, const Value legendre_data[],
+                                               Value scl_fourier[]) const {
+    ATLAS_TRACE("TransLocal: transposition Legendre to Fourier");
+    const auto& comm   = mpi::comm(mpi_comm_);
+    const int nb_parts = static_cast<int>(comm.size());
+    const int nump     = static_cast<int>(nmyms_.size());
+
+    std::vector<int> send_counts(nb_parts), send_displs(nb_parts);
+    std::vector<int> recv_counts(nb_parts, 0), recv_displs(nb_parts);
+    for (int p = 0; p < nb_parts; ++p) {
+        send_counts[p] = nb_fields * 2 * nump * (lat_begin_[p + 1] - lat_begin_[p]);
+    }
+    for (int jm = 0; jm <= truncation_; ++jm) {
+        recv_counts[m_part_[jm]] += nb_fields * 2 * nlats_local_;
+    }
+    send_displs[0] = 0;
+    recv_displs[0] = 0;
+    for (int p = 1; p < nb_parts; ++p) {
+        send_displs[p] = send_displs[p - 1] + send_counts[p - 1];
+        recv_displs[p] = recv_displs[p - 1] + recv_counts[p - 1];
+    }
+    std::vector<Value> send_buffer(send_displs.back() + send_counts.back());
+    std::vector<Value> recv_buffer(recv_displs.back() + recv_counts.back());
+
+    // send: local zonal wavenumbers for the latitudes of partition p
+    for (int p = 0; p < nb_parts; ++p) {
+        size_t idx = send_displs[p];
+        for (int jml = 0; jml < nump; ++jml) {
+            for (idx_t jlat = lat_begin_[p]; jlat < lat_begin_[p + 1]; ++jlat) {
+                for (int imag = 0; imag < 2; ++imag) {
+                    for (int jfld = 0; jfld < nb_fields; ++jfld) {
+                        send_buffer[idx++] = legendre_data[posLegendre(jfld, imag, jlat, jml, nb_fields, nlats)];
+                    }
+                }
+            }
+        }
+    }
+
+    comm.allToAllv(send_buffer.data(), send_counts.data(), send_displs.data(), recv_buffer.data(),
+                   recv_counts.data(), recv_displs.data());
+
+    // receive: zonal wavenumbers of partition p, in ascending order, for the local latitudes
+    std::vector<size_t> idx(recv_displs.begin(), recv_displs.end());
+    for (int jm = 0; jm <= truncation_; ++jm) {
+        size_t& i = idx[m_part_[jm]];
+        for (idx_t jlat = 0; jlat < nlats_local_; ++jlat) {
+            for (int imag = 0; imag < 2; ++imag) {
+                for (int jfld = 0; jfld < nb_fields; ++jfld) {
+                    scl_fourier[posMethod(jfld, imag, jlat, jm, nb_fields, nlats_local_)] = recv_buffer[i++];
+                }
+            }
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+void TransLocal::transpose_fourier_to_legendre(const int nlats, const int nb_fields, const double scl_fourier[],
+                                               double legendre_data[]) const {
+    ATLAS_TRACE("TransLocal: transposition Fourier to Legendre");
+    const auto& comm   = mpi::comm(mpi_comm_);
+    const int nb_parts = static_cast<int>(comm.size());
+    const int nump     = static_cast<int>(nmyms_.size());
+
+    // Reverse of transpose_legendre_to_fourier
+    std::vector<int> send_counts(nb_parts, 0), send_displs(nb_parts);
+    std::vector<int> recv_counts(nb_parts), recv_displs(nb_parts);
+    for (int jm = 0; jm <= truncation_; ++jm) {
+        send_counts[m_part_[jm]] += nb_fields * 2 * nlats_local_;
+    }
+    for (int p = 0; p < nb_parts; ++p) {
+        recv_counts[p] = nb_fields * 2 * nump * (lat_begin_[p + 1] - lat_begin_[p]);
+    }
+    send_displs[0] = 0;
+    recv_displs[0] = 0;
+    for (int p = 1; p < nb_parts; ++p) {
+        send_displs[p] = send_displs[p - 1] + send_counts[p - 1];
+        recv_displs[p] = recv_displs[p - 1] + recv_counts[p - 1];
+    }
+    std::vector<double> send_buffer(send_displs.back() + send_counts.back());
+    std::vector<double> recv_buffer(recv_displs.back() + recv_counts.back());
+
+    std::vector<size_t> idx(send_displs.begin(), send_displs.end());
+    for (int jm = 0; jm <= truncation_; ++jm) {
+        size_t& i = idx[m_part_[jm]];
+        for (idx_t jlat = 0; jlat < nlats_local_; ++jlat) {
+            for (int imag = 0; imag < 2; ++imag) {
+                for (int jfld = 0; jfld < nb_fields; ++jfld) {
+                    send_buffer[i++] = scl_fourier[posMethod(jfld, imag, jlat, jm, nb_fields, nlats_local_)];
+                }
+            }
+        }
+    }
+
+    comm.allToAllv(send_buffer.data(), send_counts.data(), send_displs.data(), recv_buffer.data(),
+                   recv_counts.data(), recv_displs.data());
+
+    for (int p = 0; p < nb_parts; ++p) {
+        size_t i = recv_displs[p];
+        for (int jml = 0; jml < nump; ++jml) {
+            for (idx_t jlat = lat_begin_[p]; jlat < lat_begin_[p + 1]; ++jlat) {
+                for (int imag = 0; imag < 2; ++imag) {
+                    for (int jfld = 0; jfld < nb_fields; ++jfld) {
+                        legendre_data[posLegendre(jfld, imag, jlat, jml, nb_fields, nlats)] = recv_buffer[i++];
+                    }
+                }
+            }
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
 const functionspace::Spectral& TransLocal::spectral() const {
     if (not spectral_) {
         spectral_ = functionspace::Spectral(Trans(this));
@@ -812,6 +1271,14 @@ void TransLocal::invtrans(const Field& spfield, Field& gpfield, const eckit::Con
     int nb_scalar_fields = 1;
     ATLAS_ASSERT(spfield.rank() == 1, "Only rank-1 fields supported at the moment");
     ATLAS_ASSERT(gpfield.rank() == 1, "Only rank-1 fields supported at the moment");
+    ATLAS_ASSERT(spfield.datatype() == gpfield.datatype(), "Spectral and grid point datatypes differ");
+
+    if (spfield.datatype() == array::DataType::kind<float>()) {
+        const auto scalar_spectra = array::make_view<float, 1>(spfield);
+        auto gp_fields            = array::make_view<float, 1>(gpfield);
+        invtrans(nb_scalar_fields, scalar_spectra.data(), gp_fields.data(), config);
+        return;
+    }
     const auto scalar_spectra = array::make_view<double, 1>(spfield);
     auto gp_fields            = array::make_view<double, 1>(gpfield);
 
@@ -921,11 +1388,26 @@ void TransLocal::invtrans(const int nb_scalar_fields, const double scalar_spectr
     invtrans_uv(truncation_, nb_scalar_fields, 0, scalar_spectra, gp_fields, config);
 }
 
+// --------------------------------------------------------------------------------------------------------------------
+
+void TransLocal::invtrans(const int nb_scalar_fields, const float scalar_spectra[], float gp_fields[],
+                          const eckit::Configuration& config) const {
+    if (not(StructuredGrid(grid_) && not grid_.projection())) {
+        throw_NotImplemented("TransLocal: single precision transforms are only implemented for structured grids",
+                             Here());
+    }
+    setup_single_precision();
+    if (nb_scalar_fields > 0) {
+        invtrans_structured(truncation_, nb_scalar_fields, 0, scalar_spectra, gp_fields, config);
+    }
+}
+
 
 // --------------------------------------------------------------------------------------------------------------------
 
+template <typename Value>
 void TransLocal::invtrans_legendre(const int truncation, const int nlats, const int nb_fields,
-                                   const int /*nb_vordiv_fields*/, const double scalar_spectra[], double scl_fourier[],
+                                   const int /*nb_vordiv_fields*/, const Value scalar_spectra[], Value scl_fourier[],
                                    const eckit::Configuration&) const {
     // Legendre transform:
     {
@@ -934,160 +1416,182 @@ void TransLocal::invtrans_legendre(const int truncation, const int nlats, const
                      << std::endl;
         linalg::dense::Backend linalg_backend{linalg_backend_};
         ATLAS_TRACE("Inverse Legendre Transform (GEMM)");
-        for (int jm = 0; jm <= truncation_; jm++) {
-            size_t size_sym  = num_n(truncation_ + 1, jm, true);
-            size_t size_asym = num_n(truncation_ + 1, jm, false);
-            const int n_imag = (jm ? 2 : 1);
-            int size_fourier = nb_fields * n_imag * (nlatsLegReduced_ - nlat0_[jm]);
-            if (size_fourier > 0) {
-                auto posFourier = [&](int jfld, int imag, int jlat, int jm, int nlatsH) {
-                    return jfld + nb_fields * (imag + n_imag * (nlatsLegReduced_ - nlat0_[jm] - nlatsH + jlat));
-                };
-                // THESE ARE REALLOCATED FOR EACH jm ???
-                // THEY COULD ALLOCATED ONCE BEFORE jm LOOP WITH A MAXIMUM SIZE?
-                double* scalar_sym;
-                double* scalar_asym;
-                double* scl_fourier_sym;
-                double* scl_fourier_asym;
-                alloc_aligned(scalar_sym, n_imag * nb_fields * size_sym);
-                alloc_aligned(scalar_asym, n_imag * nb_fields * size_asym);
-                alloc_aligned(scl_fourier_sym, size_fourier);
-                alloc_aligned(scl_fourier_asym, size_fourier);
-                {
-                    //ATLAS_TRACE( "Legendre split" );
-                    idx_t idx = 0, is = 0, ia = 0, ioff = (2 * truncation + 3 - jm) * jm / 2 * nb_fields * 2;
-                    // the choice between the following two code lines determines whether
-                    // total wavenumbers are summed in an ascending or descending order.
-                    // The trans library in IFS uses descending order because it should
-                    // be more accurate (higher wavenumbers have smaller contributions).
-                    // This also needs to be changed when splitting the spectral data in
-                    // compute_legendre_polynomials!
-                    //for ( int jn = jm; jn <= truncation_ + 1; jn++ ) {
-                    for (int jn = truncation_ + 1; jn >= jm; jn--) {
-                        for (int imag = 0; imag < n_imag; imag++) {
-                            for (int jfld = 0; jfld < nb_fields; jfld++) {
-                                idx = jfld + nb_fields * (imag + 2 * (jn - jm));
-                                if (jn <= truncation && jm < truncation) {
-                                    if ((jn - jm) % 2 == 0) {
-                                        scalar_sym[is++] = scalar_spectra[idx + ioff];
-                                    }
-                                    else {
-                                        scalar_asym[ia++] = scalar_spectra[idx + ioff];
-                                    }
-                                }
-                                else {
-                                    if ((jn - jm) % 2 == 0) {
-                                        scalar_sym[is++] = 0.;
+        const Value* legendre_sym;
+        const Value* legendre_asym;
+        legendre_coefficients(legendre_sym, legendre_asym);
+
+        // Work buffers are allocated once for each thread, with the sizes required by jm = 0
+        const size_t size_sym_max     = add_padding(2 * nb_fields * num_n(truncation_ + 1, 0, true));
+        const size_t size_asym_max    = add_padding(2 * nb_fields * num_n(truncation_ + 1, 0, false));
+        const size_t size_fourier_max = add_padding(2 * nb_fields * nlatsLegReduced_);
+        const size_t size_workspace   = size_sym_max + size_asym_max + 2 * size_fourier_max;
+        Value* workspace;
+        alloc_aligned(workspace, atlas_omp_get_max_threads() * size_workspace, "Legendre workspace");
+
+        // Sizes are checked here, as an exception cannot leave the parallel region below
+        const int nump = static_cast<int>(nmyms_.size());
+        std::vector<size_t> sizes_sym(nump), sizes_asym(nump);
+        for (int jml = 0; jml < nump; jml++) {
+            sizes_sym[jml]  = num_n(truncation_ + 1, nmyms_[jml], true);
+            sizes_asym[jml] = num_n(truncation_ + 1, nmyms_[jml], false);
+            ATLAS_ASSERT(2 * nb_fields * sizes_sym[jml] <= size_sym_max);
+            ATLAS_ASSERT(2 * nb_fields * sizes_asym[jml] <= size_asym_max);
+        }
+
+        ATLAS_ASSERT(linalg_backend.available(),
+                     "Unsupported linalg backend " + detect_linalg_backend(linalg_backend_));
+
+        // The cost per zonal wavenumber decreases with jm: hand out one jm at a time, largest first
+        const bool parallel_jm = not threaded_linalg_backend(linalg_backend_);
+        SerialNestedParallelism serial_gemm;
+        ParallelExceptions exceptions;
+        atlas_omp_pragma(omp parallel for schedule(dynamic, 1) if(parallel_jm))
+        for (int jml = 0; jml < nump; jml++) {
+            exceptions.run([&] {
+                const int jm     = nmyms_[jml];
+                size_t size_sym  = sizes_sym[jml];
+                size_t size_asym = sizes_asym[jml];
+                const int n_imag = (jm ? 2 : 1);
+                int size_fourier = nb_fields * n_imag * (nlatsLegReduced_ - nlat0_[jm]);
+                if (size_fourier > 0) {
+                    auto posFourier = [&](int jfld, int imag, int jlat, int jm, int nlatsH) {
+                        return jfld + nb_fields * (imag + n_imag * (nlatsLegReduced_ - nlat0_[jm] - nlatsH + jlat));
+                    };
+                    Value* scalar_sym       = workspace + atlas_omp_get_thread_num() * size_workspace;
+                    Value* scalar_asym      = scalar_sym + size_sym_max;
+                    Value* scl_fourier_sym  = scalar_asym + size_asym_max;
+                    Value* scl_fourier_asym = scl_fourier_sym + size_fourier_max;
+                    {
+                        //ATLAS_TRACE( "Legendre split" );
+                        // local offset of jm; spectral data with truncation != truncation_ is never distributed
+                        idx_t ioff = (truncation == truncation_) ? spectral_begin_[jml] * nb_fields
+                                                                 : (2 * truncation + 3 - jm) * jm / 2 * nb_fields * 2;
+                        idx_t idx = 0, is = 0, ia = 0;
+                        // the choice between the following two code lines determines whether
+                        // total wavenumbers are summed in an ascending or descending order.
+                        // The trans library in IFS uses descending order because it should
+                        // be more accurate (higher wavenumbers have smaller contributions).
+                        // This also needs to be changed when splitting the spectral data in
+                        // compute_legendre_polynomials!
+                        //for ( int jn = jm; jn <= truncation_ + 1; jn++ ) {
+                        for (int jn = truncation_ + 1; jn >= jm; jn--) {
+                            for (int imag = 0; imag < n_imag; imag++) {
+                                for (int jfld = 0; jfld < nb_fields; jfld++) {
+                                    idx = jfld + nb_fields * (imag + 2 * (jn - jm));
+                                    if (jn <= truncation && jm < truncation) {
+                                        if ((jn - jm) % 2 == 0) {
+                                            scalar_sym[is++] = scalar_spectra[idx + ioff];
+                                        }
+                                        else {
+                                            scalar_asym[ia++] = scalar_spectra[idx + ioff];
+                                        }
                                     }
                                     else {
-                                        scalar_asym[ia++] = 0.;
+                                        if ((jn - jm) % 2 == 0) {
+                                            scalar_sym[is++] = 0.;
+                                        }
+                                        else {
+                                            scalar_asym[ia++] = 0.;
+                                        }
                                     }
                                 }
                             }
                         }
                     }
-                    ATLAS_ASSERT(size_t(ia) == n_imag * nb_fields * size_asym &&
-                                 size_t(is) == n_imag * nb_fields * size_sym);
-                }
-                if (nlatsLegReduced_ - nlat0_[jm] > 0) {
-                    ATLAS_TRACE("matrix_multiply (" + std::string(linalg_backend) + ")");
-                    {
-                        linalg::Matrix A(scalar_sym, nb_fields * n_imag, size_sym);
-                        linalg::Matrix B(legendre_sym_ + legendre_sym_begin_[jm] + nlat0_[jm] * size_sym, size_sym,
-                                         nlatsLegReduced_ - nlat0_[jm]);
-                        linalg::Matrix C(scl_fourier_sym, nb_fields * n_imag, nlatsLegReduced_ - nlat0_[jm]);
-                        linalg::matrix_multiply(A, B, C, linalg_backend);
-                        /*Log::info() << "sym: ";
-                        for ( int j = 0; j < size_sym * ( nlatsLegReduced_ - nlat0_[jm] ); j++ ) {
-                            Log::info() << legendre_sym_[j + legendre_sym_begin_[jm] + nlat0_[jm] * size_sym] << " ";
+                    if (nlatsLegReduced_ - nlat0_[jm] > 0) {
+                        {
+                            gemm(scalar_sym, legendre_sym + legendre_sym_begin_[jm] + nlat0_[jm] * size_sym,
+                                 scl_fourier_sym, nb_fields * n_imag, nlatsLegReduced_ - nlat0_[jm], size_sym,
+                                 linalg_backend);
+                            /*Log::info() << "sym: ";
+                            for ( int j = 0; j < size_sym * ( nlatsLegReduced_ - nlat0_[jm] ); j++ ) {
+                                Log::info() << legendre_sym_[j + legendre_sym_begin_[jm] + nlat0_[jm] * size_sym] << " ";
+                            }
+                            Log::info() << std::endl;*/
                         }
-                        Log::info() << std::endl;*/
-                    }
-                    if (size_asym > 0) {
-                        linalg::Matrix A(scalar_asym, nb_fields * n_imag, size_asym);
-                        linalg::Matrix B(legendre_asym_ + legendre_asym_begin_[jm] + nlat0_[jm] * size_asym, size_asym,
-                                         nlatsLegReduced_ - nlat0_[jm]);
-                        linalg::Matrix C(scl_fourier_asym, nb_fields * n_imag, nlatsLegReduced_ - nlat0_[jm]);
-                        linalg::matrix_multiply(A, B, C, linalg_backend);
-                        /*Log::info() << "asym: ";
-                        for ( int j = 0; j < size_asym * ( nlatsLegReduced_ - nlat0_[jm] ); j++ ) {
-                            Log::info() << legendre_asym_[j + legendre_asym_begin_[jm] + nlat0_[jm] * size_asym] << " ";
+                        if (size_asym > 0) {
+                            gemm(scalar_asym, legendre_asym + legendre_asym_begin_[jm] + nlat0_[jm] * size_asym,
+                                 scl_fourier_asym, nb_fields * n_imag, nlatsLegReduced_ - nlat0_[jm], size_asym,
+                                 linalg_backend);
+                            /*Log::info() << "asym: ";
+                            for ( int j = 0; j < size_asym * ( nlatsLegReduced_ - nlat0_[jm] ); j++ ) {
+                                Log::info() << legendre_asym_[j + legendre_asym_begin_[jm] + nlat0_[jm] * size_asym] << " ";
+                            }
+                            Log::info() << std::endl;*/
                         }
-                        Log::info() << std::endl;*/
                     }
-                }
-                {
-                    //ATLAS_TRACE( "merge spheres" );
-                    // northern hemisphere:
-                    for (int jlat = 0; jlat < nlatsNH_; jlat++) {
-                        if (nlatsLegReduced_ - nlat0_[jm] - nlatsNH_ + jlat >= 0) {
-                            for (int imag = 0; imag < n_imag; imag++) {
-                                for (int jfld = 0; jfld < nb_fields; jfld++) {
-                                    int idx = posFourier(jfld, imag, jlat, jm, nlatsNH_);
-                                    scl_fourier[posMethod(jfld, imag, jlat, jm, nb_fields, nlats)] =
-                                        scl_fourier_sym[idx] + scl_fourier_asym[idx];
+                    {
+                        //ATLAS_TRACE( "merge spheres" );
+                        // northern hemisphere:
+                        for (int jlat = 0; jlat < nlatsNH_; jlat++) {
+                            if (nlatsLegReduced_ - nlat0_[jm] - nlatsNH_ + jlat >= 0) {
+                                for (int imag = 0; imag < n_imag; imag++) {
+                                    for (int jfld = 0; jfld < nb_fields; jfld++) {
+                                        int idx = posFourier(jfld, imag, jlat, jm, nlatsNH_);
+                                        scl_fourier[posLegendre(jfld, imag, jlat, jml, nb_fields, nlats)] =
+                                            scl_fourier_sym[idx] + scl_fourier_asym[idx];
+                                    }
                                 }
                             }
-                        }
-                        else {
-                            for (int imag = 0; imag < n_imag; imag++) {
-                                for (int jfld = 0; jfld < nb_fields; jfld++) {
-                                    scl_fourier[posMethod(jfld, imag, jlat, jm, nb_fields, nlats)] = 0.;
+                            else {
+                                for (int imag = 0; imag < n_imag; imag++) {
+                                    for (int jfld = 0; jfld < nb_fields; jfld++) {
+                                        scl_fourier[posLegendre(jfld, imag, jlat, jml, nb_fields, nlats)] = 0.;
+                                    }
                                 }
                             }
-                        }
-                        /*for ( int imag = 0; imag < n_imag; imag++ ) {
-                        for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                            if ( scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )] > 0. ) {
-                                Log::info() << "jm=" << jm << " jlat=" << jlat << " nlatsLeg_=" << nlatsLeg_
-                                            << " nlat0=" << nlat0_[jm] << " nlatsNH=" << nlatsNH_ << std::endl;
+                            /*for ( int imag = 0; imag < n_imag; imag++ ) {
+                            for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                                if ( scl_fourier[posLegendre( jfld, imag, jlat, jml, nb_fields, nlats )] > 0. ) {
+                                    Log::info() << "jm=" << jm << " jlat=" << jlat << " nlatsLeg_=" << nlatsLeg_
+                                                << " nlat0=" << nlat0_[jm] << " nlatsNH=" << nlatsNH_ << std::endl;
+                                }
                             }
+                        }*/
                         }
-                    }*/
-                    }
-                    // southern hemisphere:
-                    for (int jlat = 0; jlat < nlatsSH_; jlat++) {
-                        int jslat = nlats - jlat - 1;
-                        if (nlatsLegReduced_ - nlat0_[jm] - nlatsSH_ + jlat >= 0) {
-                            for (int imag = 0; imag < n_imag; imag++) {
-                                for (int jfld = 0; jfld < nb_fields; jfld++) {
-                                    int idx = posFourier(jfld, imag, jlat, jm, nlatsSH_);
-                                    scl_fourier[posMethod(jfld, imag, jslat, jm, nb_fields, nlats)] =
-                                        scl_fourier_sym[idx] - scl_fourier_asym[idx];
+                        // southern hemisphere:
+                        for (int jlat = 0; jlat < nlatsSH_; jlat++) {
+                            int jslat = nlats - jlat - 1;
+                            if (nlatsLegReduced_ - nlat0_[jm] - nlatsSH_ + jlat >= 0) {
+                                for (int imag = 0; imag < n_imag; imag++) {
+                                    for (int jfld = 0; jfld < nb_fields; jfld++) {
+                                        int idx = posFourier(jfld, imag, jlat, jm, nlatsSH_);
+                                        scl_fourier[posLegendre(jfld, imag, jslat, jml, nb_fields, nlats)] =
+                                            scl_fourier_sym[idx] - scl_fourier_asym[idx];
+                                    }
                                 }
                             }
-                        }
-                        else {
-                            for (int imag = 0; imag < n_imag; imag++) {
-                                for (int jfld = 0; jfld < nb_fields; jfld++) {
-                                    scl_fourier[posMethod(jfld, imag, jslat, jm, nb_fields, nlats)] = 0.;
+                            else {
+                                for (int imag = 0; imag < n_imag; imag++) {
+                                    for (int jfld = 0; jfld < nb_fields; jfld++) {
+                                        scl_fourier[posLegendre(jfld, imag, jslat, jml, nb_fields, nlats)] = 0.;
+                                    }
                                 }
                             }
                         }
                     }
                 }
-                free_aligned(scalar_sym);
-                free_aligned(scalar_asym);
-                free_aligned(scl_fourier_sym);
-                free_aligned(scl_fourier_asym);
-            }
-            else {
-                for (int jlat = 0; jlat < nlats; jlat++) {
-                    for (int imag = 0; imag < n_imag; imag++) {
-                        for (int jfld = 0; jfld < nb_fields; jfld++) {
-                            scl_fourier[posMethod(jfld, imag, jlat, jm, nb_fields, nlats)] = 0.;
+                else {
+                    for (int jlat = 0; jlat < nlats; jlat++) {
+                        for (int imag = 0; imag < n_imag; imag++) {
+                            for (int jfld = 0; jfld < nb_fields; jfld++) {
+                                scl_fourier[posLegendre(jfld, imag, jlat, jml, nb_fields, nlats)] = 0.;
+                            }
                         }
                     }
                 }
-            }
+            });
         }
+        free_aligned(workspace, "Legendre workspace");
+        exceptions.rethrow();
     }
 }
 
 // --------------------------------------------------------------------------------------------------------------------
 
-void TransLocal::invtrans_fourier_regular(const int nlats, const int nlons, const int nb_fields, double scl_fourier[],
-                                          double gp_fields[], const eckit::Configuration&) const {
+template <typename Value>
+void TransLocal::invtrans_fourier_regular(const int nlats, const int nlons, const int nb_fields, Value scl_fourier[],
+                                          Value gp_fields[], const eckit::Configuration&) const {
     // Fourier transformation:
     if (useFFT_) {
 #if ATLAS_HAVE_FFTW && !TRANSLOCAL_DGEMM2
@@ -1095,30 +1599,30 @@ void TransLocal::invtrans_fourier_regular(const int nlats, const int nlons, cons
             int num_complex = (nlonsMaxGlobal_ / 2) + 1;
             {
                 ATLAS_TRACE("Inverse Fourier Transform (FFTW, RegularGrid)");
+                detail::FFTW_Inverse<Value> fft(*fftw_);
                 for (int jfld = 0; jfld < nb_fields; jfld++) {
                     int idx = 0;
                     for (int jlat = 0; jlat < nlats; jlat++) {
-                        fftw_->in[idx++][0] = scl_fourier[posMethod(jfld, 0, jlat, 0, nb_fields, nlats)];
+                        fft.in[idx++][0] = scl_fourier[posMethod(jfld, 0, jlat, 0, nb_fields, nlats)];
                         for (int jm = 1; jm < num_complex; jm++, idx++) {
                             for (int imag = 0; imag < 2; imag++) {
                                 if (jm <= truncation_) {
-                                    fftw_->in[idx][imag] =
-                                        scl_fourier[posMethod(jfld, imag, jlat, jm, nb_fields, nlats)];
+                                    fft.in[idx][imag] = scl_fourier[posMethod(jfld, imag, jlat, jm, nb_fields, nlats)];
                                 }
                                 else {
-                                    fftw_->in[idx][imag] = 0.;
+                                    fft.in[idx][imag] = 0.;
                                 }
                             }
                         }
                     }
-                    fftw_execute_dft_c2r(fftw_->plans[0], fftw_->in, fftw_->out);
+                    fft.execute(0);
                     for (int jlat = 0; jlat < nlats; jlat++) {
                         for (int jlon = 0; jlon < nlons; jlon++) {
                             int j = jlon + jlonMin_[0];
                             if (j >= nlonsMaxGlobal_) {
                                 j -= nlonsMaxGlobal_;
                             }
-                            gp_fields[jlon + nlons * (jlat + nlats * jfld)] = fftw_->out[j + nlonsMaxGlobal_ * jlat];
+                            gp_fields[jlon + nlons * (jlat + nlats * jfld)] = fft.out[j + nlonsMaxGlobal_ * jlat];
                         }
                     }
                 }
@@ -1133,24 +1637,21 @@ void TransLocal::invtrans_fourier_regular(const int nlats, const int nlons, cons
         {
             ATLAS_TRACE("Inverse Fourier Transform (NoFFT,matrix_multiply=" + detect_linalg_backend(linalg_backend_) +
                         ")");
-            linalg::Matrix A(fourier_, nlons, (truncation_ + 1) * 2);
-            linalg::Matrix B(scl_fourier, (truncation_ + 1) * 2, nb_fields * nlats);
-            linalg::Matrix C(gp_fields, nlons, nb_fields * nlats);
-
-            linalg::matrix_multiply(A, B, C, linalg_backend);
+            const Value* fourier;
+            fourier_coefficients(fourier);
+            gemm(fourier, scl_fourier, gp_fields, nlons, nb_fields * nlats, (truncation_ + 1) * 2, linalg_backend);
         }
 #else
         // dgemm-method 2
         // should be faster for small domains or large truncation
         // but have not found any significant speedup so far
-        double* gp;
+        Value* gp;
         alloc_aligned(gp, nb_fields * grid_.size());
         {
             ATLAS_TRACE("Fourier dgemm method 2");
-            linalg::Matrix A(scl_fourier, nb_fields * nlats, (truncation_ + 1) * 2);
-            linalg::Matrix B(fourier_, (truncation_ + 1) * 2, nlons);
-            linalg::Matrix C(gp, nb_fields * nlats, nlons);
-            linalg::matrix_multiply(A, B, C, linalg_backend);
+            const Value* fourier;
+            fourier_coefficients(fourier);
+            gemm(scl_fourier, fourier, gp, nb_fields * nlats, nlons, (truncation_ + 1) * 2, linalg_backend);
         }
 
         // Transposition in grid point space:
@@ -1174,50 +1675,52 @@ void TransLocal::invtrans_fourier_regular(const int nlats, const int nlons, cons
 
 // --------------------------------------------------------------------------------------------------------------------
 
+template <typename Value>
 void TransLocal::invtrans_fourier_reduced(const int nlats, const StructuredGrid& g, const int nb_fields,
-                                          double scl_fourier[], double gp_fields[], const eckit::Configuration&) const {
+                                          Value scl_fourier[], Value gp_fields[], const eckit::Configuration&) const {
     // Fourier transformation:
     if (useFFT_) {
 #if ATLAS_HAVE_FFTW && !TRANSLOCAL_DGEMM2
         {
             {
                 ATLAS_TRACE("Inverse Fourier Transform (FFTW, ReducedGrid)");
+                detail::FFTW_Inverse<Value> fft(*fftw_);
                 int jgp = 0;
                 for (int jfld = 0; jfld < nb_fields; jfld++) {
                     for (int jlat = 0; jlat < nlats; jlat++) {
-                        int idx = 0;
+                        int jglb = jlat_begin_ + jlat;  // latitude index in the grid
+                        int idx  = 0;
                         //Log::info() << jlat << "in:" << std::endl;
-                        int num_complex     = (nlonsGlobal_[jlat] / 2) + 1;
-                        fftw_->in[idx++][0] = scl_fourier[posMethod(jfld, 0, jlat, 0, nb_fields, nlats)];
-                        //Log::info() << fftw_->in[0][0] << " ";
+                        int num_complex  = (nlonsGlobal_[jglb] / 2) + 1;
+                        fft.in[idx++][0] = scl_fourier[posMethod(jfld, 0, jlat, 0, nb_fields, nlats)];
+                        //Log::info() << fft.in[0][0] << " ";
                         for (int jm = 1; jm < num_complex; jm++, idx++) {
                             for (int imag = 0; imag < 2; imag++) {
                                 if (jm <= truncation_) {
-                                    fftw_->in[idx][imag] =
-                                        scl_fourier[posMethod(jfld, imag, jlat, jm, nb_fields, nlats)];
+                                    fft.in[idx][imag] = scl_fourier[posMethod(jfld, imag, jlat, jm, nb_fields, nlats)];
                                 }
                                 else {
-                                    fftw_->in[idx][imag] = 0.;
+                                    fft.in[idx][imag] = 0.;
                                 }
-                                //Log::info() << fftw_->in[idx][imag] << " ";
+                                //Log::info() << fft.in[idx][imag] << " ";
                             }
                         }
                         //Log::info() << std::endl;
                         //Log::info() << jlat << "out:" << std::endl;
-                        int jplan = nlatsLegDomain_ - nlatsNH_ + jlat;
+                        int jplan = nlatsLegDomain_ - nlatsNH_ + jglb;
                         if (jplan >= nlatsLegDomain_) {
-                            jplan = nlats - 1 + nlatsLegDomain_ - nlatsSH_ - jlat;
+                            jplan = g.ny() - 1 + nlatsLegDomain_ - nlatsSH_ - jglb;
                         };
                         //ASSERT( jplan < nlatsLeg_ && jplan >= 0 );
-                        fftw_execute_dft_c2r(fftw_->plans[jplan], fftw_->in, fftw_->out);
-                        for (int jlon = 0; jlon < g.nx(jlat); jlon++) {
-                            int j = jlon + jlonMin_[jlat];
-                            if (j >= nlonsGlobal_[jlat]) {
-                                j -= nlonsGlobal_[jlat];
+                        fft.execute(jplan);
+                        for (int jlon = 0; jlon < g.nx(jglb); jlon++) {
+                            int j = jlon + jlonMin_[jglb];
+                            if (j >= nlonsGlobal_[jglb]) {
+                                j -= nlonsGlobal_[jglb];
                             }
-                            //Log::info() << fftw_->out[j] << " ";
+                            //Log::info() << fft.out[j] << " ";
                             ATLAS_ASSERT(j < nlonsMaxGlobal_);
-                            gp_fields[jgp++] = fftw_->out[j];
+                            gp_fields[jgp++] = fft.out[j];
                         }
                         //Log::info() << std::endl;
                     }
@@ -1227,9 +1730,35 @@ void TransLocal::invtrans_fourier_reduced(const int nlats, const StructuredGrid&
 #endif
     }
     else {
-        throw_NotImplemented(
-            "Using dgemm in Fourier transform for reduced grids is extremely slow. Please install and use FFTW!",
-            Here());
+        // Without FFT, every latitude is synthesised with a discrete Fourier transform on its own longitudes
+        ATLAS_TRACE("Inverse Fourier Transform (NoFFT, ReducedGrid)");
+        std::vector<idx_t> gp_begin(nlats + 1, 0);
+        for (int jlat = 0; jlat < nlats; jlat++) {
+            gp_begin[jlat + 1] = gp_begin[jlat] + g.nx(jlat_begin_ + jlat);
+        }
+        const idx_t nb_gp = gp_begin[nlats];
+        atlas_omp_parallel_for(int jlat = 0; jlat < nlats; jlat++) {
+            const int jglb   = jlat_begin_ + jlat;  // latitude index in the grid
+            const int nlons  = g.nx(jglb);
+            const int nmodes = std::min(truncation_, nlons / 2);
+            std::vector<double> cosm(nmodes + 1), sinm(nmodes + 1);
+            for (int jlon = 0; jlon < nlons; jlon++) {
+                const double lon = g.x(jlon, jglb) * util::Constants::degreesToRadians();
+                for (int jm = 1; jm <= nmodes; jm++) {
+                    const double factor = (2 * jm == nlons ? 1. : 2.);
+                    cosm[jm]            = +factor * std::cos(jm * lon);
+                    sinm[jm]            = -factor * std::sin(jm * lon);
+                }
+                for (int jfld = 0; jfld < nb_fields; jfld++) {
+                    double gp = scl_fourier[posMethod(jfld, 0, jlat, 0, nb_fields, nlats)];
+                    for (int jm = 1; jm <= nmodes; jm++) {
+                        gp += cosm[jm] * scl_fourier[posMethod(jfld, 0, jlat, jm, nb_fields, nlats)] +
+                              sinm[jm] * scl_fourier[posMethod(jfld, 1, jlat, jm, nb_fields, nlats)];
+                    }
+                    gp_fields[gp_begin[jlat] + jlon + nb_gp * jfld] = gp;
+                }
+            }
+        }
     }
 }
 
@@ -1428,6 +1957,86 @@ void TransLocal::invtrans_unstructured(const int truncation, const int nb_fields
     free_aligned(zfn);
 }
 
+// --------------------------------------------------------------------------------------------------------------------
+
+// Structured grid part of invtrans_uv, also used for single precision scalar transforms
+template <typename Value>
+void TransLocal::invtrans_structured(const int truncation, const int nb_fields, const int nb_vordiv_fields,
+                                     const Value scalar_spectra[], Value gp_fields[],
+                                     const eckit::Configuration& config) const {
+    if (std::is_same<Value, double>::value) {
+        check_double_precision();
+    }
+    auto g = StructuredGrid(grid_);
+    ATLAS_TRACE("invtrans_uv structured");
+    int nlats            = g.ny();
+    int nlons            = g.nxmax();
+    int size_fourier_max = nb_fields * 2 * nlats_local_;
+    Value* scl_fourier;
+    alloc_aligned(scl_fourier, size_fourier_max * (truncation_ + 1));
+
+    // ATLAS-159 workaround begin
+    for (int i = 0; i < size_fourier_max * (truncation_ + 1); ++i) {
+        scl_fourier[i] = 0.;
+    }
+    // ATLAS-159 workaround end
+
+    // Legendre transformation:
+    if (distributed_) {
+        // local zonal wavenumbers on all latitudes, then transposed to all zonal wavenumbers on local latitudes
+        const size_t size_legendre = nb_fields * 2 * nlats * nmyms_.size();
+        Value* legendre_data;
+        alloc_aligned(legendre_data, size_legendre);
+        for (size_t i = 0; i < size_legendre; ++i) {
+            legendre_data[i] = 0.;
+        }
+        invtrans_legendre(truncation, nlats, nb_fields, nb_vordiv_fields, scalar_spectra, legendre_data, config);
+        transpose_legendre_to_fourier(nlats, nb_fields, legendre_data, scl_fourier);
+        free_aligned(legendre_data);
+    }
+    else {
+        invtrans_legendre(truncation, nlats, nb_fields, nb_vordiv_fields, scalar_spectra, scl_fourier, config);
+    }
+
+    // Fourier transformation:
+    if (RegularGrid(gridGlobal_)) {
+        invtrans_fourier_regular(nlats_local_, nlons, nb_fields, scl_fourier, gp_fields, config);
+    }
+    else {
+        invtrans_fourier_reduced(nlats_local_, g, nb_fields, scl_fourier, gp_fields, config);
+    }
+
+    // Computing u,v from U,V:
+    {
+        if (nb_vordiv_fields > 0) {
+            ATLAS_TRACE("compute u,v from U,V");
+            std::vector<double> coslatinvs(nlats);
+            for (idx_t j = 0; j < nlats; ++j) {
+                double lat = g.y(j);
+                if (lat > latPole) {
+                    lat = latPole;
+                }
+                if (lat < -latPole) {
+                    lat = -latPole;
+                }
+                double coslat = std::cos(lat * util::Constants::degreesToRadians());
+                coslatinvs[j] = 1. / coslat;
+                //Log::info() << "lat=" << g.y( j ) << " coslat=" << coslat << std::endl;
+            }
+            int idx = 0;
+            for (idx_t jfld = 0; jfld < 2 * nb_vordiv_fields && jfld < nb_fields; jfld++) {
+                for (idx_t jlat = 0; jlat < g.ny(); jlat++) {
+                    for (idx_t jlon = 0; jlon < g.nx(jlat); jlon++) {
+                        gp_fields[idx] *= coslatinvs[jlat];
+                        idx++;
+                    }
+                }
+            }
+        }
+    }
+    free_aligned(scl_fourier);
+}
+
 //-----------------------------------------------------------------------------
 // Routine to compute the spectral transform by using a Local Fourier transformation
 // for a grid (same latitude for all longitudes, allows to compute Legendre functions
@@ -1447,65 +2056,9 @@ void TransLocal::invtrans_uv(const int truncation, const int nb_scalar_fields, c
                              const double scalar_spectra[], double gp_fields[],
                              const eckit::Configuration& config) const {
     if (nb_scalar_fields > 0) {
-        int nb_fields = nb_scalar_fields;
-
         // Transform
         if (StructuredGrid(grid_) && not grid_.projection()) {
-            auto g = StructuredGrid(grid_);
-            ATLAS_TRACE("invtrans_uv structured");
-            int nlats            = g.ny();
-            int nlons            = g.nxmax();
-            int size_fourier_max = nb_fields * 2 * nlats;
-            double* scl_fourier;
-            alloc_aligned(scl_fourier, size_fourier_max * (truncation_ + 1));
-
-            // ATLAS-159 workaround begin
-            for (int i = 0; i < size_fourier_max * (truncation_ + 1); ++i) {
-                scl_fourier[i] = 0.;
-            }
-            // ATLAS-159 workaround end
-
-            // Legendre transformation:
-            invtrans_legendre(truncation, nlats, nb_scalar_fields, nb_vordiv_fields, scalar_spectra, scl_fourier,
-                              config);
-
-            // Fourier transformation:
-            if (RegularGrid(gridGlobal_)) {
-                invtrans_fourier_regular(nlats, nlons, nb_fields, scl_fourier, gp_fields, config);
-            }
-            else {
-                invtrans_fourier_reduced(nlats, g, nb_fields, scl_fourier, gp_fields, config);
-            }
-
-            // Computing u,v from U,V:
-            {
-                if (nb_vordiv_fields > 0) {
-                    ATLAS_TRACE("compute u,v from U,V");
-                    std::vector<double> coslatinvs(nlats);
-                    for (idx_t j = 0; j < nlats; ++j) {
-                        double lat = g.y(j);
-                        if (lat > latPole) {
-                            lat = latPole;
-                        }
-                        if (lat < -latPole) {
-                            lat = -latPole;
-                        }
-                        double coslat = std::cos(lat * util::Constants::degreesToRadians());
-                        coslatinvs[j] = 1. / coslat;
-                        //Log::info() << "lat=" << g.y( j ) << " coslat=" << coslat << std::endl;
-                    }
-                    int idx = 0;
-                    for (idx_t jfld = 0; jfld < 2 * nb_vordiv_fields && jfld < nb_fields; jfld++) {
-                        for (idx_t jlat = 0; jlat < g.ny(); jlat++) {
-                            for (idx_t jlon = 0; jlon < g.nx(jlat); jlon++) {
-                                gp_fields[idx] *= coslatinvs[jlat];
-                                idx++;
-                            }
-                        }
-                    }
-                }
-            }
-            free_aligned(scl_fourier);
+            invtrans_structured(truncation, nb_scalar_fields, nb_vordiv_fields, scalar_spectra, gp_fields, config);
         }
         else {
             if (unstruct_precomp_) {
@@ -1555,6 +2108,11 @@ void TransLocal::invtrans(const int nb_scalar_fields, const double scalar_spectr
                           const double vorticity_spectra[], const double divergence_spectra[], double gp_fields[],
                           const eckit::Configuration& config) const {
     int nb_gp = grid_.size();
+    if (nb_vordiv_fields > 0 && distributed_) {
+        throw_NotImplemented("TransLocal: inverse transforms of vorticity and divergence are not implemented with more "
+                             "than 1 MPI task",
+                             Here());
+    }
     if (nb_vordiv_fields > 0) {
         // collect all spectral data into one array "all_spectra":
         ATLAS_TRACE("TransLocal::invtrans");
@@ -1652,17 +2210,25 @@ void TransLocal::invtrans_adj(const int nb_scalar_fields, const double gp_fields
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::dirtrans(const Field& gpfield, Field& spfield, const eckit::Configuration& config) const {
-    ATLAS_NOTIMPLEMENTED;
-    // Not implemented and not planned.
-    // Use the TransIFS implementation instead.
+    int nb_scalar_fields = 1;
+    ATLAS_ASSERT(gpfield.rank() == 1, "Only rank-1 fields supported at the moment");
+    ATLAS_ASSERT(spfield.rank() == 1, "Only rank-1 fields supported at the moment");
+    const auto gp_fields = array::make_view<double, 1>(gpfield);
+    auto scalar_spectra  = array::make_view<double, 1>(spfield);
+
+    ATLAS_ASSERT(gp_fields.shape(0) >= nb_gridpoints_local_);
+    ATLAS_ASSERT(scalar_spectra.shape(0) >= idx_t(nb_spectral_coefficients()));
+
+    dirtrans(nb_scalar_fields, gp_fields.data(), scalar_spectra.data(), config);
 }
 
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::dirtrans(const FieldSet& gpfields, FieldSet& spfields, const eckit::Configuration& config) const {
-    ATLAS_NOTIMPLEMENTED;
-    // Not implemented and not planned.
-    // Use the TransIFS implementation instead.
+    ATLAS_ASSERT(gpfields.size() == spfields.size());
+    for (idx_t f = 0; f < gpfields.size(); ++f) {
+        dirtrans(gpfields[f], spfields[f], config);
+    }
 }
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -1697,13 +2263,313 @@ void TransLocal::dirtrans_wind2vordiv_adj(const Field& spvor, const Field& spdiv
 }
 
 
+// --------------------------------------------------------------------------------------------------------------------
+
+void TransLocal::dirtrans_fourier_regular(const int nlats, const int nlons, const int nb_fields,
+                                          const double gp_fields[], double scl_fourier[],
+                                          const eckit::Configuration&) const {
+    // Fourier transformation:
+    if (useFFT_) {
+#if ATLAS_HAVE_FFTW && !TRANSLOCAL_DGEMM2
+        {
+            int num_complex = (nlonsMaxGlobal_ / 2) + 1;
+            double scale    = 1. / nlonsMaxGlobal_;
+            ATLAS_TRACE("Direct Fourier Transform (FFTW, RegularGrid)");
+            for (int jfld = 0; jfld < nb_fields; jfld++) {
+                for (int jlat = 0; jlat < nlats; jlat++) {
+                    for (int jlon = 0; jlon < nlons; jlon++) {
+                        int j = jlon + jlonMin_[0];
+                        if (j >= nlonsMaxGlobal_) {
+                            j -= nlonsMaxGlobal_;
+                        }
+                        fftw_->out[j + nlonsMaxGlobal_ * jlat] = gp_fields[jlon + nlons * (jlat + nlats * jfld)];
+                    }
+                }
+                fftw_execute_dft_r2c(fftw_->plans_dir[0], fftw_->out, fftw_->in);
+                for (int jlat = 0; jlat < nlats; jlat++) {
+                    for (int jm = 0; jm <= truncation_; jm++) {
+                        for (int imag = 0; imag < 2; imag++) {
+                            scl_fourier[posMethod(jfld, imag, jlat, jm, nb_fields, nlats)] =
+                                (jm < num_complex && (jm > 0 || imag == 0))
+                                    ? fftw_->in[jm + num_complex * jlat][imag] * scale
+                                    : 0.;
+                        }
+                    }
+                }
+            }
+        }
+#endif
+    }
+    else {
+#if !TRANSLOCAL_DGEMM2
+        // The direct Fourier matrix is the transpose of the inverse one (fourier_), without the
+        // factor 2 for jm > 0 and scaled with 1/nlons
+        linalg::dense::Backend linalg_backend{linalg_backend_};
+        ATLAS_TRACE("Direct Fourier Transform (NoFFT,matrix_multiply=" + detect_linalg_backend(linalg_backend_) + ")");
+        const int nb_modes = 2 * (truncation_ + 1);
+        double* fourier_dir;
+        alloc_aligned(fourier_dir, nb_modes * nlons);
+        for (int jlon = 0; jlon < nlons; jlon++) {
+            for (int jmode = 0; jmode < nb_modes; jmode++) {
+                double factor = (jmode < 2 ? 1. : 0.5) / nlons;
+                fourier_dir[jmode + nb_modes * jlon] = fourier_[jlon + nlons * jmode] * factor;
+            }
+        }
+        linalg::Matrix A(fourier_dir, nb_modes, nlons);
+        linalg::Matrix B(const_cast<double*>(gp_fields), nlons, nb_fields * nlats);
+        linalg::Matrix C(scl_fourier, nb_modes, nb_fields * nlats);
+        linalg::matrix_multiply(A, B, C, linalg_backend);
+        free_aligned(fourier_dir);
+#else
+        ATLAS_NOTIMPLEMENTED;
+#endif
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+void TransLocal::dirtrans_fourier_reduced(const int nlats, const StructuredGrid& g, const int nb_fields,
+                                          const double gp_fields[], double scl_fourier[],
+                                          const eckit::Configuration&) const {
+    // Fourier transformation:
+    if (useFFT_) {
+#if ATLAS_HAVE_FFTW && !TRANSLOCAL_DGEMM2
+        {
+            ATLAS_TRACE("Direct Fourier Transform (FFTW, ReducedGrid)");
+            int jgp = 0;
+            for (int jfld = 0; jfld < nb_fields; jfld++) {
+                for (int jlat = 0; jlat < nlats; jlat++) {
+                    int jglb = jlat_begin_ + jlat;  // latitude index in the grid
+                    for (int jlon = 0; jlon < g.nx(jglb); jlon++) {
+                        int j = jlon + jlonMin_[jglb];
+                        if (j >= nlonsGlobal_[jglb]) {
+                            j -= nlonsGlobal_[jglb];
+                        }
+                        fftw_->out[j] = gp_fields[jgp++];
+                    }
+                    int jplan = nlatsLegDomain_ - nlatsNH_ + jglb;
+                    if (jplan >= nlatsLegDomain_) {
+                        jplan = g.ny() - 1 + nlatsLegDomain_ - nlatsSH_ - jglb;
+                    };
+                    fftw_execute_dft_r2c(fftw_->plans_dir[jplan], fftw_->out, fftw_->in);
+                    int num_complex = (nlonsGlobal_[jglb] / 2) + 1;
+                    double scale    = 1. / nlonsGlobal_[jglb];
+                    for (int jm = 0; jm <= truncation_; jm++) {
+                        for (int imag = 0; imag < 2; imag++) {
+                            scl_fourier[posMethod(jfld, imag, jlat, jm, nb_fields, nlats)] =
+                                (jm < num_complex && (jm > 0 || imag == 0)) ? fftw_->in[jm][imag] * scale : 0.;
+                        }
+                    }
+                }
+            }
+        }
+#endif
+    }
+    else {
+        // Without FFT, every latitude is analysed with a discrete Fourier transform on its own longitudes
+        ATLAS_TRACE("Direct Fourier Transform (NoFFT, ReducedGrid)");
+        std::vector<idx_t> gp_begin(nlats + 1, 0);
+        for (int jlat = 0; jlat < nlats; jlat++) {
+            gp_begin[jlat + 1] = gp_begin[jlat] + g.nx(jlat_begin_ + jlat);
+        }
+        const idx_t nb_gp = gp_begin[nlats];
+        atlas_omp_parallel_for(int jlat = 0; jlat < nlats; jlat++) {
+            const int jglb     = jlat_begin_ + jlat;  // latitude index in the grid
+            const int nlons    = g.nx(jglb);
+            const int nmodes   = std::min(truncation_, nlons / 2);
+            const double scale = 1. / nlons;
+            std::vector<double> cosm(nmodes + 1), sinm(nmodes + 1);
+            for (int jfld = 0; jfld < nb_fields; jfld++) {
+                for (int jm = 0; jm <= truncation_; jm++) {
+                    for (int imag = 0; imag < 2; imag++) {
+                        scl_fourier[posMethod(jfld, imag, jlat, jm, nb_fields, nlats)] = 0.;
+                    }
+                }
+            }
+            for (int jlon = 0; jlon < nlons; jlon++) {
+                const double lon = g.x(jlon, jglb) * util::Constants::degreesToRadians();
+                for (int jm = 0; jm <= nmodes; jm++) {
+                    cosm[jm] = +scale * std::cos(jm * lon);
+                    sinm[jm] = -scale * std::sin(jm * lon);
+                }
+                for (int jfld = 0; jfld < nb_fields; jfld++) {
+                    const double gp = gp_fields[gp_begin[jlat] + jlon + nb_gp * jfld];
+                    for (int jm = 0; jm <= nmodes; jm++) {
+                        scl_fourier[posMethod(jfld, 0, jlat, jm, nb_fields, nlats)] += cosm[jm] * gp;
+                        if (jm > 0) {
+                            scl_fourier[posMethod(jfld, 1, jlat, jm, nb_fields, nlats)] += sinm[jm] * gp;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+void TransLocal::dirtrans_legendre(const int nlats, const int nb_fields, const double scl_fourier[],
+                                   double scalar_spectra[], const eckit::Configuration&) const {
+    // Legendre analysis with Gaussian quadrature. This is the transpose of invtrans_legendre, weighted
+    // with the quadrature weights: each hemisphere pair of latitudes contributes to the symmetric
+    // coefficients with the sum and to the antisymmetric coefficients with the difference.
+    Log::debug() << "TransLocal::dirtrans_legendre: Legendre GEMM with \"" << detect_linalg_backend(linalg_backend_)
+                 << "\"" << std::endl;
+    linalg::dense::Backend linalg_backend{linalg_backend_};
+    ATLAS_TRACE("Direct Legendre Transform (GEMM)");
+
+    // Work buffers are allocated once for each thread, with the sizes required by jm = 0
+    const size_t size_sym_max     = add_padding(2 * nb_fields * num_n(truncation_ + 1, 0, true));
+    const size_t size_asym_max    = add_padding(2 * nb_fields * num_n(truncation_ + 1, 0, false));
+    const size_t size_fourier_max = add_padding(2 * nb_fields * nlatsLegReduced_);
+    const size_t size_workspace   = size_sym_max + size_asym_max + 2 * size_fourier_max;
+    double* workspace;
+    alloc_aligned(workspace, atlas_omp_get_max_threads() * size_workspace, "Legendre workspace");
+
+    // Sizes are checked here, as an exception cannot leave the parallel region below
+    const int nump = static_cast<int>(nmyms_.size());
+    std::vector<size_t> sizes_sym(nump), sizes_asym(nump);
+    for (int jml = 0; jml < nump; jml++) {
+        sizes_sym[jml]  = num_n(truncation_ + 1, nmyms_[jml], true);
+        sizes_asym[jml] = num_n(truncation_ + 1, nmyms_[jml], false);
+        ATLAS_ASSERT(2 * nb_fields * sizes_sym[jml] <= size_sym_max);
+        ATLAS_ASSERT(2 * nb_fields * sizes_asym[jml] <= size_asym_max);
+    }
+
+    ATLAS_ASSERT(linalg_backend.available(),
+                 "Unsupported linalg backend " + detect_linalg_backend(linalg_backend_));
+
+    // The cost per zonal wavenumber decreases with jm: hand out one jm at a time, largest first
+    const bool parallel_jm = not threaded_linalg_backend(linalg_backend_);
+    SerialNestedParallelism serial_gemm;
+    ParallelExceptions exceptions;
+    atlas_omp_pragma(omp parallel for schedule(dynamic, 1) if(parallel_jm))
+    for (int jml = 0; jml < nump; jml++) {
+        exceptions.run([&] {
+            const int jm     = nmyms_[jml];
+            size_t size_sym  = sizes_sym[jml];
+            size_t size_asym = sizes_asym[jml];
+            const int n_imag = (jm ? 2 : 1);
+            const int nlatsJ = nlatsLegReduced_ - nlat0_[jm];
+            const int nfi    = nb_fields * n_imag;
+            idx_t ioff       = spectral_begin_[jml] * nb_fields;
+
+            double* scalar_sym   = workspace + atlas_omp_get_thread_num() * size_workspace;
+            double* scalar_asym  = scalar_sym + size_sym_max;
+            double* fourier_sym  = scalar_asym + size_asym_max;
+            double* fourier_asym = fourier_sym + size_fourier_max;
+            for (size_t i = 0; i < size_sym * nfi; ++i) {
+                scalar_sym[i] = 0.;
+            }
+            for (size_t i = 0; i < size_asym * nfi; ++i) {
+                scalar_asym[i] = 0.;
+            }
+            if (nlatsJ > 0) {
+                {
+                    //ATLAS_TRACE( "split spheres" );
+                    for (int jl = 0; jl < nlatsJ; jl++) {
+                        int jlat  = nlat0_[jm] + jl;
+                        int jslat = nlats - jlat - 1;
+                        double w  = quadrature_weights_[jlat];
+                        for (int imag = 0; imag < n_imag; imag++) {
+                            for (int jfld = 0; jfld < nb_fields; jfld++) {
+                                double north      = scl_fourier[posLegendre(jfld, imag, jlat, jml, nb_fields, nlats)];
+                                double south      = scl_fourier[posLegendre(jfld, imag, jslat, jml, nb_fields, nlats)];
+                                int idx           = jl + nlatsJ * (jfld + nb_fields * imag);
+                                fourier_sym[idx]  = w * (north + south);
+                                fourier_asym[idx] = w * (north - south);
+                            }
+                        }
+                    }
+                }
+                {
+                    linalg::Matrix A(legendre_sym_ + legendre_sym_begin_[jm] + nlat0_[jm] * size_sym, size_sym, nlatsJ);
+                    linalg::Matrix B(fourier_sym, nlatsJ, nfi);
+                    linalg::Matrix C(scalar_sym, size_sym, nfi);
+                    linalg::matrix_multiply(A, B, C, linalg_backend);
+                }
+                if (size_asym > 0) {
+                    linalg::Matrix A(legendre_asym_ + legendre_asym_begin_[jm] + nlat0_[jm] * size_asym, size_asym,
+                                     nlatsJ);
+                    linalg::Matrix B(fourier_asym, nlatsJ, nfi);
+                    linalg::Matrix C(scalar_asym, size_asym, nfi);
+                    linalg::matrix_multiply(A, B, C, linalg_backend);
+                }
+            }
+            {
+                //ATLAS_TRACE( "Legendre merge" );
+                // same (descending) order of total wavenumbers as in compute_legendre_polynomials
+                size_t is = 0, ia = 0;
+                for (int jn = truncation_ + 1; jn >= jm; jn--) {
+                    bool sym = ((jn - jm) % 2 == 0);
+                    size_t k = sym ? is++ : ia++;
+                    if (jn > truncation_) {
+                        continue;
+                    }
+                    for (int imag = 0; imag < 2; imag++) {
+                        for (int jfld = 0; jfld < nb_fields; jfld++) {
+                            idx_t idx = jfld + nb_fields * (imag + 2 * (jn - jm)) + ioff;
+                            if (imag < n_imag) {
+                                int r               = jfld + nb_fields * imag;
+                                scalar_spectra[idx] =
+                                    sym ? scalar_sym[k + size_sym * r] : scalar_asym[k + size_asym * r];
+                            }
+                            else {
+                                scalar_spectra[idx] = 0.;
+                            }
+                        }
+                    }
+                }
+            }
+        });
+    }
+    free_aligned(workspace, "Legendre workspace");
+    exceptions.rethrow();
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::dirtrans(const int nb_fields, const double scalar_fields[], double scalar_spectra[],
-                          const eckit::Configuration&) const {
-    ATLAS_NOTIMPLEMENTED;
-    // Not implemented and not planned.
-    // Use the TransIFS implementation instead.
+                          const eckit::Configuration& config) const {
+    if (quadrature_weights_.empty()) {
+        throw_NotImplemented("TransLocal::dirtrans is only implemented for global Gaussian grids. Grid: " +
+                                 grid_.name() + ". Use the TransIFS implementation instead.",
+                             Here());
+    }
+    check_double_precision();
+    ATLAS_TRACE("TransLocal::dirtrans");
+    auto g           = StructuredGrid(grid_);
+    int nlats        = g.ny();
+    int nlons        = g.nxmax();
+    int size_fourier = nb_fields * 2 * nlats_local_ * (truncation_ + 1);
+    double* scl_fourier;
+    alloc_aligned(scl_fourier, size_fourier);
+    for (int i = 0; i < size_fourier; ++i) {
+        scl_fourier[i] = 0.;
+    }
+
+    // Fourier transformation:
+    if (RegularGrid(gridGlobal_)) {
+        dirtrans_fourier_regular(nlats_local_, nlons, nb_fields, scalar_fields, scl_fourier, config);
+    }
+    else {
+        dirtrans_fourier_reduced(nlats_local_, g, nb_fields, scalar_fields, scl_fourier, config);
+    }
+
+    // Legendre transformation:
+    if (distributed_) {
+        // all zonal wavenumbers on local latitudes, transposed to local zonal wavenumbers on all latitudes
+        double* legendre_data;
+        alloc_aligned(legendre_data, nb_fields * 2 * nlats * nmyms_.size());
+        transpose_fourier_to_legendre(nlats, nb_fields, scl_fourier, legendre_data);
+        dirtrans_legendre(nlats, nb_fields, legendre_data, scalar_spectra, config);
+        free_aligned(legendre_data);
+    }
+    else {
+        dirtrans_legendre(nlats, nb_fields, scl_fourier, scalar_spectra, config);
+    }
+
+    free_aligned(scl_fourier);
 }
 
 // --------------------------------------------------------------------------------------------------------------------
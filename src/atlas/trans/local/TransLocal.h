@@ -11,10 +11,12 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "atlas/array.h"
 #include "atlas/functionspace/Spectral.h"
+#include "atlas/grid/Distribution.h"
 #include "atlas/grid/Grid.h"
 #include "atlas/linalg/dense/Backend.h"
 #include "atlas/trans/detail/TransImpl.h"
@@ -59,8 +61,27 @@ int fourier_truncation(const int truncation,  // truncation
 ///  - support multiple fields
 ///  - support atlas::Field and atlas::FieldSet based on function spaces
 ///
-/// @note: Direct transforms are not implemented and cannot be unless
-///        the grid is global. There are no plans to support this at the moment.
+/// @note: Direct transforms are only implemented for scalar fields on global Gaussian grids,
+///        where the Legendre analysis can use Gaussian quadrature. Direct transforms of wind
+///        fields and adjoint transforms are not implemented.
+///        Without FFTW, the Fourier transforms of reduced grids are discrete Fourier transforms per latitude.
+///
+/// @note: With more than one MPI task (or a "mpi_comm" with more than one task given in the Configuration),
+///        only global structured grids are supported. Spectral coefficients are then distributed by zonal
+///        wavenumber, see zonal_wavenumbers(), and grid points by latitude bands, see distribution().
+///        The local spectral data contains the coefficients of the local zonal wavenumbers in ascending
+///        order, with the same layout as the global spectral data.
+///        The precomputed Legendre coefficients are only stored for the local zonal wavenumbers, unless
+///        a Legendre cache is read, exported or written, as the cache holds all zonal wavenumbers.
+///        Only scalar fields can be transformed in this mode: invtrans with vorticity and divergence
+///        fields throws eckit::NotImplemented. spectral() still describes the global spectral data.
+///
+/// @note: Inverse transforms of scalar fields on structured grids can be computed in single precision,
+///        with float spectral and grid point data (also as atlas::Field with datatype float).
+///        The Legendre transform is then done entirely in single precision, with linalg::dense::sgemm, as
+///        the configured matrix_multiply backends only support double precision.
+///        With "precision": "single" in the Configuration, only single precision coefficients are kept,
+///        and double precision transforms throw an exception.
 ///
 /// @note: The matrix_multiply (GEMM) implementation can be configured within the Configuration argument in the constructor
 ///        using "matrix_multiply" key or if not given, it will use the atlas::linalg::dense::current_backend(),
@@ -72,6 +93,10 @@ int fourier_truncation(const int truncation,  // truncation
 ///        - "lapack"  : "lapack"  backend for eckit::linalg::LinearAlgebra
 ///        - "openmp"  : "openmp"  backend for eckit::linalg::LinearAlgebra, or "generic" if "openmp" is not available.
 ///        - "eigen"   : "eigen"   backend for eckit::linalg::LinearAlgebra
+///
+/// @note: The Legendre transforms are threaded over zonal wavenumbers. Nested OpenMP parallelism is disabled
+///        meanwhile, so that each GEMM runs on one thread. With the "mkl" backend, which has its own threads,
+///        the zonal wavenumbers are processed one after another and the GEMM is threaded instead.
 
 class TransLocal : public trans::TransImpl {
 public:
@@ -85,9 +110,15 @@ public:
 
     virtual int truncation() const override { return truncation_; }
 
-    virtual size_t nb_spectral_coefficients() const override { return (truncation_ + 1) * (truncation_ + 2); }
+    virtual size_t nb_spectral_coefficients() const override { return spectral_begin_.back(); }
     virtual size_t nb_spectral_coefficients_global() const override { return (truncation_ + 1) * (truncation_ + 2); }
 
+    /// @brief Zonal wavenumbers of the local spectral coefficients, in ascending order
+    const std::vector<int>& zonal_wavenumbers() const { return nmyms_; }
+
+    /// @brief Distribution of the grid points in latitude bands, matching the local grid point data
+    grid::Distribution distribution() const;
+
     virtual const Grid& grid() const override { return grid_; }
     virtual const functionspace::Spectral& spectral() const override;
 
@@ -130,6 +161,14 @@ public:
     virtual void invtrans(const int nb_scalar_fields, const double scalar_spectra[], double gp_fields[],
                           const eckit::Configuration& = util::NoConfig()) const override;
 
+    /// @brief Inverse transform of scalar fields in single precision, for structured grids
+    ///
+    /// Legendre and Fourier coefficients are converted to single precision on first use, or in the constructor
+    /// when configured with "precision": "single". The FFT is computed in single precision when FFTW was found
+    /// with single precision support, and in double precision otherwise.
+    void invtrans(const int nb_scalar_fields, const float scalar_spectra[], float gp_fields[],
+                  const eckit::Configuration& = util::NoConfig()) const;
+
     virtual void invtrans(const int nb_vordiv_fields, const double vorticity_spectra[],
                           const double divergence_spectra[], double gp_fields[],
                           const eckit::Configuration& = util::NoConfig()) const override;
@@ -145,14 +184,17 @@ public:
                               double divergence_spectra[],
                               const eckit::Configuration& = util::NoConfig()) const override;
 
-    // -- NOT SUPPORTED -- //
-
     virtual void dirtrans(const Field& gpfield, Field& spfield,
                           const eckit::Configuration& = util::NoConfig()) const override;
 
     virtual void dirtrans(const FieldSet& gpfields, FieldSet& spfields,
                           const eckit::Configuration& = util::NoConfig()) const override;
 
+    virtual void dirtrans(const int nb_fields, const double scalar_fields[], double scalar_spectra[],
+                          const eckit::Configuration& = util::NoConfig()) const override;
+
+    // -- NOT SUPPORTED -- //
+
     virtual void dirtrans_wind2vordiv(const Field& gpwind, Field& spvor, Field& spdiv,
                                       const eckit::Configuration& = util::NoConfig()) const override;
 
@@ -165,9 +207,6 @@ public:
     virtual void dirtrans_wind2vordiv_adj(const Field& spvor, const Field& spdiv, Field& gpwind,
                                           const eckit::Configuration& = util::NoConfig()) const override;
 
-    virtual void dirtrans(const int nb_fields, const double scalar_fields[], double scalar_spectra[],
-                          const eckit::Configuration& = util::NoConfig()) const override;
-
     virtual void dirtrans(const int nb_fields, const double wind_fields[], double vorticity_spectra[],
                           double divergence_spectra[], const eckit::Configuration& = util::NoConfig()) const override;
 
@@ -181,15 +220,49 @@ private:
 #endif
     }
 
+    // position in the output of the Legendre transform, for the local zonal wavenumber index jml
+    int posLegendre(const int jfld, const int imag, const int jlat, const int jml, const int nb_fields,
+                    const int nlats) const {
+#if !TRANSLOCAL_DGEMM2
+        return imag + 2 * (jml + static_cast<int>(nmyms_.size()) * (jlat + nlats * jfld));
+#else
+        return jfld + nb_fields * (jlat + nlats * (imag + 2 * (jml)));
+#endif
+    }
+
+    void setup_distribution();
+
+    void setup_single_precision() const;
+    void check_double_precision() const;
+
+    void legendre_coefficients(const double*& legendre_sym, const double*& legendre_asym) const;
+    void legendre_coefficients(const float*& legendre_sym, const float*& legendre_asym) const;
+
+    void fourier_coefficients(const double*& fourier) const;
+    void fourier_coefficients(const float*& fourier) const;
+
+    template <typename Value>
+    void transpose_legendre_to_fourier(const int nlats, const int nb_fields, const Value legendre_data[],
+                                       Value scl_fourier[]) const;
+
+    void transpose_fourier_to_legendre(const int nlats, const int nb_fields, const double scl_fourier[],
+                                       double legendre_data[]) const;
+
+    template <typename Value>
     void invtrans_legendre(const int truncation, const int nlats, const int nb_fields, const int nb_vordiv_fields,
-                           const double scalar_spectra[], double scl_fourier[],
-                           const eckit::Configuration& config) const;
+                           const Value scalar_spectra[], Value scl_fourier[], const eckit::Configuration& config) const;
 
-    void invtrans_fourier_regular(const int nlats, const int nlons, const int nb_fields, double scl_fourier[],
-                                  double gp_fields[], const eckit::Configuration& config) const;
+    template <typename Value>
+    void invtrans_fourier_regular(const int nlats, const int nlons, const int nb_fields, Value scl_fourier[],
+                                  Value gp_fields[], const eckit::Configuration& config) const;
 
-    void invtrans_fourier_reduced(const int nlats, const StructuredGrid& g, const int nb_fields, double scl_fourier[],
-                                  double gp_fields[], const eckit::Configuration& config) const;
+    template <typename Value>
+    void invtrans_fourier_reduced(const int nlats, const StructuredGrid& g, const int nb_fields, Value scl_fourier[],
+                                  Value gp_fields[], const eckit::Configuration& config) const;
+
+    template <typename Value>
+    void invtrans_structured(const int truncation, const int nb_fields, const int nb_vordiv_fields,
+                             const Value scalar_spectra[], Value gp_fields[], const eckit::Configuration& config) const;
 
     void invtrans_unstructured_precomp(const int truncation, const int nb_scalar_fields, const int nb_vordiv_fields,
                                        const double scalar_spectra[], double gp_fields[],
@@ -203,6 +276,16 @@ private:
                      const double scalar_spectra[], double gp_fields[],
                      const eckit::Configuration& = util::NoConfig()) const;
 
+    void dirtrans_fourier_regular(const int nlats, const int nlons, const int nb_fields, const double gp_fields[],
+                                  double scl_fourier[], const eckit::Configuration& config) const;
+
+    void dirtrans_fourier_reduced(const int nlats, const StructuredGrid& g, const int nb_fields,
+                                  const double gp_fields[], double scl_fourier[],
+                                  const eckit::Configuration& config) const;
+
+    void dirtrans_legendre(const int nlats, const int nb_fields, const double scl_fourier[],
+                           double scalar_spectra[], const eckit::Configuration& config) const;
+
     bool warning(const eckit::Configuration& = util::NoConfig()) const;
 
     friend class LegendreCacheCreatorLocal;
@@ -237,6 +320,15 @@ private:
     std::vector<size_t> legendre_begin_;
     std::vector<size_t> legendre_sym_begin_;
     std::vector<size_t> legendre_asym_begin_;
+    std::vector<double> quadrature_weights_;  // Gaussian quadrature weights (northern hemisphere), for dirtrans
+
+    // single precision copies of legendre_sym_, legendre_asym_ and fourier_, created on first use,
+    // or in the constructor with "precision": "single", which then frees the double precision ones
+    bool single_precision_only_{false};
+    mutable std::once_flag single_precision_once_;
+    mutable float* legendre_sym_f_{nullptr};
+    mutable float* legendre_asym_f_{nullptr};
+    mutable float* fourier_f_{nullptr};
 
     Cache cache_;
     Cache export_legendre_;
@@ -249,6 +341,17 @@ private:
 
     std::string linalg_backend_;
     int warning_ = 0;
+
+    // parallel distribution
+    std::string mpi_comm_;
+    bool distributed_{false};
+    std::vector<int> nmyms_;              // local zonal wavenumbers
+    std::vector<int> m_part_;             // partition of each zonal wavenumber
+    std::vector<size_t> spectral_begin_;  // offset of local spectral data of each local zonal wavenumber, per field
+    std::vector<idx_t> lat_begin_;        // first latitude of each partition, size nb_partitions + 1
+    idx_t jlat_begin_{0};                 // first local latitude
+    idx_t nlats_local_{0};                // number of local latitudes
+    idx_t nb_gridpoints_local_{0};        // number of local grid points
 };
 
 //-----------------------------------------------------------------------------
@@ -116,6 +116,7 @@ void GridPointsJSONWriter::write(std::ostream& out, std::ostream* info) const {
     auto writePoint = [&out](const Point2& p) {
         out << "[" << p[0] << "," << p[1] << "]";
     };
+    std::vector<double> chunk_lonlat;  // buffer for coordinates of a chunk of grid points
 
     if(nb_partitions_ == 0 || field_ == "partition") {
         out << "[";
@@ -188,13 +189,14 @@ void GridPointsJSONWriter::write(std::ostream& out, std::ostream* info) const {
                 end = std::min<size_t>(grid_.size(),begin+chunk_size);
                 write_progress();
                 if (field_ == "lonlat") {
-                    auto it = grid_.lonlat().begin()+begin;
-                    for (size_t n=begin; n<end; ++n, ++it) {
+                    chunk_lonlat.resize(2 * (end - begin));
+                    grid_.compute_lonlat(begin, end, chunk_lonlat.data());
+                    for (size_t n=begin; n<end; ++n) {
                         if (n!=0) {
                             out << join;
                         }
                         out << indent;
-                        writePoint(*it);
+                        writePoint(PointLonLat{chunk_lonlat[2*(n-begin)], chunk_lonlat[2*(n-begin)+1]});
                     }
                 }
                 else if (field_ == "index" ) {
@@ -246,14 +248,15 @@ void GridPointsJSONWriter::write(std::ostream& out, std::ostream* info) const {
             std::string join = points_newline ? ",\n" : ",";
             std::string indent(points_indent,' ');
             if( field_ == "lonlat" ) {
-                auto it = grid_.lonlat().begin() + begin;
-                for (size_t j=0; j<size; ++j, ++it) {
+                chunk_lonlat.resize(2 * size);
+                grid_.compute_lonlat(begin, end, chunk_lonlat.data());
+                for (size_t j=0; j<size; ++j) {
                     if (part[j] == partition) {
                         if (n!=0) {
                             out << join;
                         }
                         out << indent;
-                        writePoint(*it);
+                        writePoint(PointLonLat{chunk_lonlat[2*j], chunk_lonlat[2*j+1]});
                         ++n;
                     }
                 }
@@ -46,6 +46,13 @@ namespace util {
 ///     auto neighbours = search.closestPoints( PointLonLat{180., 45.}, k ).payloads();
 /// @endcode
 /// The variable `neighbours` is now a container of indices (the payloads) of the 4 nearest points
+///
+/// Many points can be searched at once, writing into preallocated arrays
+/// @code{.cpp}
+///     std::vector<idx_t> neighbours( points.size() * k );
+///     std::vector<double> distances( points.size() * k );
+///     search.closestPoints( points.data(), points.size(), k, neighbours.data(), distances.data() );
+/// @endcode
 
 template <typename PayloadT, typename PointT = Point3>
 class KDTree : public ObjectHandle<detail::KDTreeBase<PayloadT, PointT>> {
@@ -162,6 +169,17 @@ public:
         return get()->closestPoints(p, k);
     }
 
+    /// @brief Find k closest points for each of n 3D cartesian points (x,y,z) or 2D lonlat points (lon,lat)
+    ///
+    /// Payloads and distances of the neighbours of points[i], sorted by distance, are written to
+    /// payloads[i*k+j] and distances[i*k+j] with j < k, without allocating per point.
+    /// The distances may be a nullptr. The queries are done in parallel with OpenMP.
+    template <typename Point>
+    void closestPoints(const Point points[], size_t n, size_t k, Payload payloads[],
+                       double distances[] = nullptr) const {
+        get()->closestPoints(points, n, k, payloads, distances);
+    }
+
     /// @brief Find closest point given a 3D cartesian point (x,y,z) or 2D lonlat point(lon,lat)
     template <typename Point>
     Value closestPoint(const Point& p) const {
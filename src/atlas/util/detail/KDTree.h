@@ -10,12 +10,19 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <iosfwd>
+#include <limits>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "eckit/container/KDTree.h"
 
 #include "atlas/library/config.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/parallel/omp/sort.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/util/Geometry.h"
@@ -202,6 +209,17 @@ public:
         return do_closestPoints(p, k);
     }
 
+    /// @brief Find k nearest neighbours for each of n 3D cartesian points (x,y,z) or 2D lonlat points (lon,lat)
+    ///
+    /// The payloads and distances of the neighbours of points[i], sorted by distance, are written to
+    /// payloads[i*k+j] and distances[i*k+j] with j < k. The distances may be a nullptr if they are not needed.
+    template <typename Point>
+    void closestPoints(const Point points[], size_t n, size_t k, Payload payloads[], double distances[]) const {
+        std::vector<PointT> xyz(n);
+        atlas_omp_parallel_for(size_t i = 0; i < n; ++i) { xyz[i] = make_Point(points[i]); }
+        do_closestPoints(xyz.data(), n, k, payloads, distances);
+    }
+
     /// @brief Find nearest neighbour given a 3D cartesian point (x,y,z)
     template <typename Point>
     Value closestPoint(const Point& p) const {
@@ -230,6 +248,9 @@ private:
     /// @brief Find k nearest neighbours given a 3D cartesian point (x,y,z)
     virtual ValueList do_closestPoints(const Point&, size_t k) const = 0;
 
+    /// @brief Find k nearest neighbours for each of n 3D cartesian points (x,y,z)
+    virtual void do_closestPoints(const Point[], size_t n, size_t k, Payload[], double[]) const = 0;
+
     /// @brief Find nearest neighbour given a 3D cartesian point (x,y,z)
     virtual Value do_closestPoint(const Point&) const = 0;
 
@@ -255,6 +276,8 @@ private:
         return do_closestPointsWithinRadius(make_Point(p), radius);
     }
 
+    Point make_Point(const Point& p) const { return p; }
+
     template <typename LonLat, ENABLE_IF_3D_AND_IS_LONLAT(LonLat)>
     Point make_Point(const LonLat& lonlat) const {
         static_assert(std::is_base_of<Point2, LonLat>::value, "LonLat must be derived from Point2");
@@ -266,6 +289,54 @@ private:
 #undef ENABLE_IF_3D_AND_IS_LONLAT
 };
 
+//------------------------------------------------------------------------------------------------------
+
+/// @brief Position of each point along a Z-order (Morton) space-filling curve through their bounding box
+///
+/// Points that are close on the curve are close in space, so that neighbouring queries in this order
+/// visit mostly the same tree nodes.
+template <typename Point>
+std::vector<size_t> space_filling_curve_order(const Point points[], size_t n) {
+    constexpr size_t dims = Point::DIMS;
+    constexpr size_t bits = 63 / dims;
+    constexpr double cells = double((uint64_t(1) << bits) - 1);
+
+    std::vector<double> min(dims, std::numeric_limits<double>::max());
+    std::vector<double> scale(dims, std::numeric_limits<double>::lowest());
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t d = 0; d < dims; ++d) {
+            min[d]   = std::min(min[d], points[i][d]);
+            scale[d] = std::max(scale[d], points[i][d]);
+        }
+    }
+    for (size_t d = 0; d < dims; ++d) {
+        scale[d] = scale[d] > min[d] ? cells / (scale[d] - min[d]) : 0.;
+    }
+
+    std::vector<uint64_t> code(n);
+    atlas_omp_parallel_for(size_t i = 0; i < n; ++i) {
+        uint64_t cell[dims];
+        for (size_t d = 0; d < dims; ++d) {
+            cell[d] = static_cast<uint64_t>(std::min(cells, (points[i][d] - min[d]) * scale[d]));
+        }
+        uint64_t c = 0;
+        for (size_t b = bits; b-- > 0;) {
+            for (size_t d = 0; d < dims; ++d) {
+                c = (c << 1) | ((cell[d] >> b) & 1);
+            }
+        }
+        code[i] = c;
+    }
+
+    std::vector<size_t> order(n);
+    for (size_t i = 0; i < n; ++i) {
+        order[i] = i;
+    }
+    omp::sort(order.begin(), order.end(),
+              [&code](size_t a, size_t b) { return code[a] < code[b] || (code[a] == code[b] && a < b); });
+    return order;
+}
+
 //------------------------------------------------------------------------------------------------------
 // Concrete implementation
 
@@ -341,6 +412,10 @@ public:
     /// @brief Find k nearest neighbours given a 3D cartesian point (x,y,z)
     ValueList do_closestPoints(const Point&, size_t k) const override;
 
+    /// @brief Find k nearest neighbours for each of n 3D cartesian points (x,y,z)
+    /// The queries are distributed over OpenMP threads in the order of a space-filling curve through the points.
+    void do_closestPoints(const Point[], size_t n, size_t k, Payload[], double[]) const override;
+
     /// @brief Find nearest neighbour given a 3D cartesian point (x,y,z)
     Value do_closestPoint(const Point&) const override;
 
@@ -369,6 +444,9 @@ private:
 template <typename Payload, typename Point>
 using KDTreeMemory = KDTree_eckit<typename eckit::KDTreeMemory<typename KDTreeBase<Payload, Point>::KDTreeTraits>>;
 
+template <typename Payload, typename Point>
+using KDTreeMapped = KDTree_eckit<typename eckit::KDTreeMapped<typename KDTreeBase<Payload, Point>::KDTreeTraits>>;
+
 //------------------------------------------------------------------------------------------------------
 
 template <typename TreeT, typename PayloadT, typename PointT>
@@ -409,6 +487,31 @@ typename KDTree_eckit<TreeT, PayloadT, PointT>::ValueList KDTree_eckit<TreeT, Pa
     return tree_->kNearestNeighbours(p, k);
 }
 
+template <typename TreeT, typename PayloadT, typename PointT>
+void KDTree_eckit<TreeT, PayloadT, PointT>::do_closestPoints(const Point points[], size_t n, size_t k,
+                                                             Payload payloads[], double distances[]) const {
+    assert_built();
+    if (n == 0 || k == 0) {
+        return;
+    }
+    if (k > size_t(size())) {
+        throw_Exception("KDTree contains fewer than the " + std::to_string(k) + " requested points", Here());
+    }
+    const std::vector<size_t> order = space_filling_curve_order(points, n);
+    atlas_omp_parallel_for(size_t j = 0; j < n; ++j) {
+        const size_t i = order[j];
+        const auto nn  = tree_->kNearestNeighbours(points[i], k);
+        for (size_t l = 0; l < k; ++l) {
+            payloads[i * k + l] = nn[l].payload();
+        }
+        if (distances) {
+            for (size_t l = 0; l < k; ++l) {
+                distances[i * k + l] = nn[l].distance();
+            }
+        }
+    }
+}
+
 template <typename TreeT, typename PayloadT, typename PointT>
 typename KDTree_eckit<TreeT, PayloadT, PointT>::Value KDTree_eckit<TreeT, PayloadT, PointT>::do_closestPoint(
     const Point& p) const {
@@ -468,6 +468,50 @@ CASE("test_functionspace_NodeColumns") {
                                      option::name("tmp"));
 }
 
+CASE("test_functionspace_NodeColumns_orderIndependentSum") {
+    // Values which cancel exactly, but not when summed in floating point arithmetic
+    Grid grid("O16");
+    Mesh mesh = StructuredMeshGenerator().generate(grid);
+    functionspace::NodeColumns fs(mesh, option::levels(3));
+
+    Field field = fs.createField<double>(option::name("field") | option::variables(2));
+    auto view   = array::make_view<double, 3>(field);
+    for (idx_t n = 0; n < view.shape(0); ++n) {
+        for (idx_t j = 0; j < 2; ++j) {
+            view(n, 0, j) = 1.e20 * (j + 1);
+            view(n, 1, j) = j + 1;
+            view(n, 2, j) = -1.e20 * (j + 1);
+        }
+    }
+    const double nb_nodes = fs.nb_nodes_global();
+    idx_t N;
+
+    std::vector<double> sum;
+    fs.orderIndependentSum(field, sum, N);
+    EXPECT(N == fs.nb_nodes_global() * 3);
+    EXPECT(sum[0] == nb_nodes);
+    EXPECT(sum[1] == 2. * nb_nodes);
+
+    Field sum_per_level("sum", array::make_datatype<double>(), array::make_shape(3, 2));
+    fs.orderIndependentSumPerLevel(field, sum_per_level, N);
+    auto sum_per_level_view = array::make_view<double, 2>(sum_per_level);
+    for (idx_t j = 0; j < 2; ++j) {
+        EXPECT(sum_per_level_view(1, j) == (j + 1) * nb_nodes);
+        EXPECT(sum_per_level_view(0, j) == -sum_per_level_view(2, j));
+    }
+
+    Field scalar_field = fs.createField<double>(option::name("scalar"));
+    auto scalar_view   = array::make_view<double, 2>(scalar_field);
+    for (idx_t n = 0; n < scalar_view.shape(0); ++n) {
+        scalar_view(n, 0) = 1.e20;
+        scalar_view(n, 1) = 0.5;
+        scalar_view(n, 2) = -1.e20;
+    }
+    double scalar_sum;
+    fs.orderIndependentSum(scalar_field, scalar_sum, N);
+    EXPECT(scalar_sum == 0.5 * nb_nodes);
+}
+
 CASE("test_SpectralFunctionSpace") {
     idx_t truncation = 159;
     idx_t nb_levels  = 10;
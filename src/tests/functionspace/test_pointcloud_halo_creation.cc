@@ -8,6 +8,8 @@
  */
 
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "atlas/array.h"
@@ -30,6 +32,52 @@ namespace test {
 
 constexpr double tol = 1.e-12;
 
+// Compare with the halo obtained by searching a kd-tree of the entire grid around each owned point
+void check_halo_against_global_search(const Grid& grid, double halo_radius) {
+    auto config     = util::Config("halo_radius", halo_radius) | util::Config("partitioner", "equal_regions");
+    auto pointcloud = functionspace::PointCloud(grid, config);
+
+    auto distribution = grid::Distribution(grid, grid::Partitioner("equal_regions"));
+    auto kdtree       = util::IndexKDTree();
+    kdtree.reserve(grid.size());
+    std::vector<PointLonLat> points;
+    idx_t n = 0;
+    for (auto p : grid.lonlat()) {
+        kdtree.insert(p, n++);
+        points.emplace_back(p);
+    }
+    kdtree.build();
+
+    std::vector<int> keep(grid.size(), 0);
+    for (idx_t j = 0; j < grid.size(); ++j) {
+        if (distribution.partition(j) == mpi::rank()) {
+            for (idx_t jj : kdtree.closestPointsWithinRadius(points[j], halo_radius).payloads()) {
+                keep[jj] = 1;
+            }
+        }
+    }
+    std::vector<gidx_t> expected;
+    for (idx_t j = 0; j < grid.size(); ++j) {
+        if (keep[j]) {
+            expected.emplace_back(j + 1);
+        }
+    }
+
+    auto glb_idx   = array::make_view<gidx_t, 1>(pointcloud.global_index());
+    auto partition = array::make_view<int, 1>(pointcloud.partition());
+    auto ghost     = array::make_view<int, 1>(pointcloud.ghost());
+    auto lonlat    = array::make_view<double, 2>(pointcloud.lonlat());
+    EXPECT_EQ(pointcloud.size(), idx_t(expected.size()));
+    for (idx_t j = 0; j < std::min<idx_t>(pointcloud.size(), expected.size()); ++j) {
+        const gidx_t g = expected[j];
+        EXPECT_EQ(glb_idx(j), g);
+        EXPECT_EQ(partition(j), distribution.partition(g - 1));
+        EXPECT_EQ(ghost(j), int(distribution.partition(g - 1) != mpi::rank()));
+        EXPECT_APPROX_EQ(lonlat(j, 0), points[g - 1].lon(), tol);
+        EXPECT_APPROX_EQ(lonlat(j, 1), points[g - 1].lat(), tol);
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 CASE("Distributed creation from unstructured grid with halo") {
@@ -299,6 +347,17 @@ if (mpi::rank() == 0) {
 
 }
 
+CASE("Halo matches global search, structured grid") {
+    check_halo_against_global_search(Grid("O16"), 1000000.);
+}
+
+CASE("Halo matches global search, unstructured grid") {
+    std::vector<PointXY> points;
+    for (int j = 0; j < 400; ++j) {
+        points.emplace_back(std::fmod(137.508 * j, 360.) - 180., 85. - 170. * (j + 0.5) / 400.);
+    }
+    check_halo_against_global_search(UnstructuredGrid(points), 1500000.);
+}
 
 }  // namespace test
 }  // namespace atlas
@@ -0,0 +1,149 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <string>
+#include <vector>
+
+#include "eckit/utils/MD5.h"
+
+#include "atlas/grid.h"
+#include "atlas/grid/detail/distribution/DistributionRunLength.h"
+#include "atlas/grid/detail/partitioner/Partitioner.h"
+#include "atlas/util/vector.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using Grid = atlas::Grid;
+using atlas::grid::detail::distribution::DistributionRunLength;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+CASE("test_run_length_matches_array") {
+    std::vector<std::string> partitioners = {"equal_regions", "checkerboard"};
+
+    auto grid = Grid("O32");
+    for (auto type : partitioners) {
+        SECTION(type) {
+            grid::Partitioner partitioner(type, 8);
+
+            atlas::vector<int> part(grid.size());
+            partitioner.partition(grid, part.data());
+            grid::Distribution array(8, grid.size(), part.data());
+
+            EXPECT(DistributionRunLength::compresses(part.size(), part.data()));
+            grid::Distribution distribution = partitioner.partition(grid);
+
+            EXPECT_EQ(distribution.type(), type);
+            EXPECT_EQ(distribution.size(), array.size());
+            EXPECT_EQ(distribution.nb_partitions(), 8);
+            EXPECT(distribution.footprint() < array.footprint());
+            grid::Distribution from_array(new DistributionRunLength(8, grid.size(), part.data()));
+            EXPECT_EQ(distribution.hash(), array.hash());
+            EXPECT_EQ(distribution.hash(), from_array.hash());
+            EXPECT(distribution.nb_pts() == array.nb_pts());
+            EXPECT_EQ(distribution.min_pts(), array.min_pts());
+            EXPECT_EQ(distribution.max_pts(), array.max_pts());
+
+            for (gidx_t n = 0; n < grid.size(); ++n) {
+                EXPECT_EQ(distribution.partition(n), part[n]);
+            }
+
+            gidx_t begin = 100;
+            gidx_t end   = grid.size() - 100;
+            std::vector<int> range(end - begin);
+            distribution.partition(begin, end, range);
+            for (gidx_t n = begin; n < end; ++n) {
+                EXPECT_EQ(range[n - begin], part[n]);
+            }
+        }
+    }
+}
+
+CASE("test_equal_regions_runs_without_partition_array") {
+    for (std::string gridname : {"O32", "F24", "L36x19"}) {
+        auto grid = Grid(gridname);
+        for (int N : {1, 2, 5, 13, 32}) {
+            SECTION(gridname + " N=" + std::to_string(N)) {
+                grid::Partitioner partitioner("equal_regions", N);
+
+                std::vector<gidx_t> run_begin;
+                std::vector<int> run_part;
+                EXPECT(partitioner.get()->partition(grid, run_begin, run_part));
+                EXPECT(run_begin.size() < size_t(grid.size()));
+
+                atlas::vector<int> part(grid.size());
+                partitioner.partition(grid, part.data());
+
+                DistributionRunLength runs(N, grid.size(), std::move(run_begin), std::move(run_part));
+                EXPECT_EQ(runs.nb_runs(), DistributionRunLength::count_runs(part.size(), part.data()));
+                for (gidx_t n = 0; n < grid.size(); ++n) {
+                    EXPECT_EQ(runs.partition(n), part[n]);
+                }
+
+                grid::Distribution array(N, grid.size(), part.data());
+                eckit::MD5 hash;
+                runs.hash(hash);
+                EXPECT_EQ(hash.digest(), array.hash());
+            }
+        }
+    }
+}
+
+CASE("test_run_length_from_runs") {
+    // Empty runs and consecutive runs with the same partition are merged
+    DistributionRunLength distribution(3, 11, {0, 3, 3, 5, 7, 9}, {0, 2, 1, 0, 2, 2});
+    EXPECT(distribution.nb_runs() == 4);
+    EXPECT(distribution.nb_pts() == (std::vector<idx_t>{5, 2, 4}));
+
+    std::vector<int> part{0, 0, 0, 1, 1, 0, 0, 2, 2, 2, 2};
+    DistributionRunLength from_array(3, part.size(), part.data());
+    for (size_t n = 0; n < part.size(); ++n) {
+        EXPECT_EQ(distribution.partition(n), part[n]);
+    }
+
+    eckit::MD5 h1;
+    eckit::MD5 h2;
+    distribution.hash(h1);
+    from_array.hash(h2);
+    EXPECT_EQ(h1.digest(), h2.digest());
+}
+
+CASE("test_run_length_custom") {
+    std::vector<int> part{1, 1, 1, 2, 2, 1, 1, 3, 3, 3, 3};
+    DistributionRunLength distribution(0, part.size(), part.data(), 1);
+
+    EXPECT(distribution.nb_runs() == 4);
+    EXPECT_EQ(distribution.nb_partitions(), 3);
+    EXPECT_EQ(distribution.type(), "custom");
+    EXPECT(distribution.nb_pts() == (std::vector<idx_t>{5, 2, 4}));
+    for (size_t n = 0; n < part.size(); ++n) {
+        EXPECT_EQ(distribution.partition(n), part[n] - 1);
+    }
+}
+
+CASE("test_run_length_not_used_for_scattered_partitions") {
+    std::vector<int> part(1000);
+    for (size_t n = 0; n < part.size(); ++n) {
+        part[n] = n % 4;
+    }
+    EXPECT(not DistributionRunLength::compresses(part.size(), part.data()));
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
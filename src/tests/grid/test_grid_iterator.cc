@@ -13,6 +13,7 @@
 #include <sstream>
 
 #include "atlas/grid/Iterator.h"
+#include "atlas/projection/Projection.h"
 #include "atlas/grid/StructuredGrid.h"
 #include "atlas/grid/UnstructuredGrid.h"
 #include "atlas/runtime/Log.h"
@@ -90,6 +91,54 @@ CASE("test_iterator") {
 
 //-----------------------------------------------------------------------------
 
+CASE("test_compute_xy_lonlat") {
+    std::vector<PointXY> points{{0, 90},  {90, 90}, {180, 90}, {270, 90}, {0, 0},     {90, 0},
+                                {180, 0}, {270, 0}, {0, -90},  {90, -90}, {180, -90}, {270, -90}};
+
+    std::vector<Grid> grids;
+    grids.emplace_back("O32");
+    grids.emplace_back("H8");
+    grids.emplace_back("CS-LFR-12");
+    grids.emplace_back("O16", Projection(Config("type", "rotated_lonlat")("north_pole", std::vector<double>{-176., 40.})));
+    grids.emplace_back(UnstructuredGrid{points});
+
+    for (auto grid : grids) {
+        Log::info() << "grid : " << grid.name() << std::endl;
+
+        std::vector<PointXY> ref_xy;
+        std::vector<PointLonLat> ref_lonlat;
+        for (const PointXY& xy : grid.xy()) {
+            ref_xy.push_back(xy);
+        }
+        for (const PointLonLat& lonlat : grid.lonlat()) {
+            ref_lonlat.push_back(lonlat);
+        }
+
+        const idx_t size = grid.size();
+        std::vector<std::pair<idx_t, idx_t>> ranges{{0, size}, {0, 0}, {size / 3, size / 2 + 1}, {size - 1, size}};
+        for (auto& range : ranges) {
+            const idx_t begin = range.first;
+            const idx_t end   = range.second;
+            std::vector<double> xy(2 * (end - begin));
+            std::vector<double> lonlat(2 * (end - begin));
+            grid.compute_xy(begin, end, xy.data());
+            grid.compute_lonlat(begin, end, lonlat.data());
+            for (idx_t n = begin; n < end; ++n) {
+                EXPECT_APPROX_EQ(xy[2 * (n - begin) + 0], ref_xy[n].x(), 1.e-12);
+                EXPECT_APPROX_EQ(xy[2 * (n - begin) + 1], ref_xy[n].y(), 1.e-12);
+                EXPECT_APPROX_EQ(lonlat[2 * (n - begin) + 0], ref_lonlat[n].lon(), 1.e-12);
+                EXPECT_APPROX_EQ(lonlat[2 * (n - begin) + 1], ref_lonlat[n].lat(), 1.e-12);
+            }
+        }
+
+        std::vector<double> out(2);
+        EXPECT_THROWS(grid.compute_xy(size, size + 1, out.data()));
+        EXPECT_THROWS(grid.compute_lonlat(-1, 0, out.data()));
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 }  // namespace test
 }  // namespace atlas
 
@@ -13,6 +13,7 @@
 #include "eckit/types/FloatCompare.h"
 
 #include "atlas/array.h"
+#include "atlas/field.h"
 #include "atlas/functionspace.h"
 #include "atlas/functionspace/PointCloud.h"
 #include "atlas/grid.h"
@@ -76,6 +77,91 @@ CASE("test_interpolation_finite_element") {
             EXPECT(eckit::types::is_approximately_equal(target(j), check[j], interpolation_tolerance));
         }
     }
+
+    SECTION("test fieldset interpolation outputs") {
+        const idx_t nlev = 4;
+        FieldSet fields_source;
+        FieldSet fields_target;
+        fields_source.add(fs.createField<double>(option::name("a")));
+        fields_source.add(fs.createField<double>(option::name("b") | option::levels(nlev)));
+        fields_source.add(fs.createField<float>(option::name("c")));
+        fields_source.add(fs.createField<double>(option::name("d")));
+        fields_target.add(Field("a", array::make_datatype<double>(), array::make_shape(pointcloud.size())));
+        fields_target.add(Field("b", array::make_datatype<double>(), array::make_shape(pointcloud.size(), nlev)));
+        fields_target.add(Field("c", array::make_datatype<float>(), array::make_shape(pointcloud.size())));
+        fields_target.add(Field("d", array::make_datatype<double>(), array::make_shape(pointcloud.size())));
+
+        auto lonlat = array::make_view<double, 2>(fs.nodes().lonlat());
+        auto a      = array::make_view<double, 1>(fields_source["a"]);
+        auto b      = array::make_view<double, 2>(fields_source["b"]);
+        auto c      = array::make_view<float, 1>(fields_source["c"]);
+        auto d      = array::make_view<double, 1>(fields_source["d"]);
+        for (idx_t j = 0; j < fs.nodes().size(); ++j) {
+            a(j) = func(lonlat(j, LON));
+            for (idx_t k = 0; k < nlev; ++k) {
+                b(j, k) = (k + 1) * func(lonlat(j, LON));
+            }
+            c(j) = static_cast<float>(func(lonlat(j, LON)));
+            d(j) = 2. * func(lonlat(j, LON));
+        }
+
+        // Fields of the same datatype are interpolated together in one pass over the matrix
+        interpolation.execute(fields_source, fields_target);
+
+        auto ta = array::make_view<double, 1>(fields_target["a"]);
+        auto tb = array::make_view<double, 2>(fields_target["b"]);
+        auto tc = array::make_view<float, 1>(fields_target["c"]);
+        auto td = array::make_view<double, 1>(fields_target["d"]);
+
+        Field field_target("target", array::make_datatype<double>(), array::make_shape(pointcloud.size()));
+        interpolation.execute(fields_source["a"], field_target);
+        auto target = array::make_view<double, 1>(field_target);
+
+        for (idx_t j = 0; j < pointcloud.size(); ++j) {
+            EXPECT_APPROX_EQ(ta(j), target(j), 1.e-14);
+            for (idx_t k = 0; k < nlev; ++k) {
+                EXPECT_APPROX_EQ(tb(j, k), (k + 1) * target(j), 1.e-12);
+            }
+            EXPECT_APPROX_EQ(static_cast<double>(tc(j)), target(j), 1.e-5);
+            EXPECT_APPROX_EQ(td(j), 2. * target(j), 1.e-12);
+        }
+    }
+
+    SECTION("test fieldset interpolation with configured sparse backend") {
+        // Fields are not batched by the openmp kernel, but each multiplied by the configured backend
+        Interpolation interpolation_eckit(option::type("finite-element") |
+                                              util::Config("max_fraction_elems_to_try", 0.4) |
+                                              util::Config("sparse_matrix_multiply", "eckit_linalg"),
+                                          fs, pointcloud);
+
+        FieldSet fields_source;
+        FieldSet fields_target;
+        fields_source.add(fs.createField<double>(option::name("a")));
+        fields_source.add(fs.createField<double>(option::name("b")));
+        fields_target.add(Field("a", array::make_datatype<double>(), array::make_shape(pointcloud.size())));
+        fields_target.add(Field("b", array::make_datatype<double>(), array::make_shape(pointcloud.size())));
+
+        auto lonlat = array::make_view<double, 2>(fs.nodes().lonlat());
+        auto a      = array::make_view<double, 1>(fields_source["a"]);
+        auto b      = array::make_view<double, 1>(fields_source["b"]);
+        for (idx_t j = 0; j < fs.nodes().size(); ++j) {
+            a(j) = func(lonlat(j, LON));
+            b(j) = 2. * func(lonlat(j, LON));
+        }
+
+        interpolation_eckit.execute(fields_source, fields_target);
+
+        Field field_target("target", array::make_datatype<double>(), array::make_shape(pointcloud.size()));
+        interpolation.execute(fields_source["a"], field_target);
+        auto target = array::make_view<double, 1>(field_target);
+
+        auto ta = array::make_view<double, 1>(fields_target["a"]);
+        auto tb = array::make_view<double, 1>(fields_target["b"]);
+        for (idx_t j = 0; j < pointcloud.size(); ++j) {
+            EXPECT_APPROX_EQ(ta(j), target(j), 1.e-14);
+            EXPECT_APPROX_EQ(tb(j), 2. * target(j), 1.e-12);
+        }
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -249,6 +249,68 @@ CASE("test_interpolation_grid_box_average matrix with cache") {
     ATLAS_TRACE_SCOPE("Interpolate with cache") { Interpolation(config, gridA, gridB, cache).execute(fieldA, fieldB); }
 }
 
+CASE("test_interpolation_grid_box_average with memory-mapped kdtree cache") {
+    Grid gridA("O32");
+    Grid gridB("O64");
+
+    const eckit::PathName directory("test_interpolation_grid_box_average_kdtree");
+    auto cache_path = [&](const Grid& grid) { return directory / ("atlas-kdtree-v1-" + grid.uid() + ".kdtree"); };
+    const eckit::PathName path = cache_path(gridA);
+    for (const auto& p : {cache_path(gridA), cache_path(gridB)}) {
+        if (p.exists()) {
+            p.unlink();
+        }
+    }
+
+    // First time the tree is built into the file, second time the file is mapped
+    for (int pass = 0; pass < 2; ++pass) {
+        interpolation::IndexKDTreeCache cache(gridA, directory);
+        EXPECT(path.exists());
+        EXPECT_EQ(cache.tree().size(), size_t(gridA.size()));
+
+        util::IndexKDTree memory;
+        idx_t n{0};
+        for (auto p : gridA.lonlat()) {
+            memory.insert(p, n++);
+        }
+        memory.build();
+        for (auto p : {PointLonLat{180., 45.}, PointLonLat{0., -89.}, PointLonLat{359.9, 0.}}) {
+            EXPECT_EQ(cache.tree().closestPoints(p, 4).payloads(), memory.closestPoints(p, 4).payloads());
+        }
+    }
+
+    auto config        = option::type("grid-box-average").set("matrix_free", false);
+    auto config_mapped = option::type("grid-box-average").set("matrix_free", false);
+    config_mapped.set("kdtree_cache_directory", directory.asString());
+
+    Field fieldA(create_field("A", gridA.size(), 1.));
+    Field fieldB(create_field("B", gridB.size()));
+    Field fieldB_mapped(create_field("B", gridB.size()));
+
+    Interpolation(config, gridA, gridB).execute(fieldA, fieldB);
+    Interpolation(config_mapped, gridA, gridB).execute(fieldA, fieldB_mapped);
+
+    auto b        = array::make_view<double, 1>(fieldB);
+    auto b_mapped = array::make_view<double, 1>(fieldB_mapped);
+    for (idx_t i = 0; i < b.size(); ++i) {
+        EXPECT_EQ(b(i), b_mapped(i));
+    }
+
+    // A file that does not hold the points of the grid is not used, and the tree is built in memory instead
+    path.unlink();
+    EXPECT(interpolation::IndexKDTreeCache(gridB, directory));
+    eckit::PathName::rename(cache_path(gridB), path);
+    EXPECT(not interpolation::IndexKDTreeCache(gridA, directory));
+
+    Field fieldB_stale(create_field("B", gridB.size()));
+    Interpolation(config_mapped, gridA, gridB).execute(fieldA, fieldB_stale);
+    auto b_stale = array::make_view<double, 1>(fieldB_stale);
+    for (idx_t i = 0; i < b.size(); ++i) {
+        EXPECT_EQ(b(i), b_stale(i));
+    }
+    path.unlink();
+}
+
 }  // namespace test
 }  // namespace atlas
 
@@ -280,6 +280,64 @@ CASE("Interpolation with MissingValue on fieldset with heterogeneous type") {
 
 }
 
+
+CASE("Non-linear corrections applied on the fly match corrections applied to the matrix") {
+    using NonLinear = interpolation::NonLinear;
+    using Matrix    = NonLinear::Matrix;
+
+    // 3 target points, each interpolated from 3 source points
+    // (row 0: no missing, row 1: some missing, row 2: heaviest missing)
+    std::vector<eckit::linalg::Triplet> triplets{{0, 0, 0.2}, {0, 1, 0.3}, {0, 2, 0.5}, {1, 2, 0.5}, {1, 3, 0.3},
+                                                 {1, 4, 0.2}, {2, 3, 0.6}, {2, 4, 0.1}, {2, 5, 0.3}};
+    Matrix W(3, 6, triplets);
+
+    const idx_t nlev = 2;
+    Field src("src", array::make_datatype<double>(), array::make_shape(6, nlev));
+    src.metadata().set("missing_value", missingValue);
+    src.metadata().set("missing_value_type", "equals");
+    auto src_v = array::make_view<double, 2>(src);
+    for (idx_t j = 0; j < src_v.shape(0); ++j) {
+        for (idx_t k = 0; k < nlev; ++k) {
+            src_v(j, k) = j + 10. * k;
+        }
+    }
+    src_v(3, 0) = missingValue;  // level 0: missing in rows 1 and 2
+    src_v(4, 1) = missingValue;  // level 1: missing in rows 1 and 2
+
+    for (std::string type : {"missing-if-all-missing", "missing-if-any-missing", "missing-if-heaviest-missing"}) {
+        SECTION(type) {
+            NonLinear nonlinear(type, Config());
+
+            Field tgt("tgt", array::make_datatype<double>(), array::make_shape(3, nlev));
+            EXPECT(nonlinear.interpolate(W, src, tgt));
+            auto tgt_v = array::make_view<double, 2>(tgt);
+
+            for (idx_t k = 0; k < nlev; ++k) {
+                // reference: level by level with corrected copy of the matrix
+                Field src_k("src_k", array::make_datatype<double>(), array::make_shape(6));
+                src_k.metadata() = src.metadata();
+                auto src_k_v     = array::make_view<double, 1>(src_k);
+                for (idx_t j = 0; j < src_k_v.shape(0); ++j) {
+                    src_k_v(j) = src_v(j, k);
+                }
+                Matrix W_nl(W);
+                nonlinear.execute(W_nl, src_k);
+
+                const auto outer  = W_nl.outer();
+                const auto index  = W_nl.inner();
+                const auto weight = W_nl.data();
+                for (idx_t r = 0; r < 3; ++r) {
+                    double expected = 0.;
+                    for (auto c = outer[r]; c < outer[r + 1]; ++c) {
+                        expected += weight[c] * src_k_v(index[c]);
+                    }
+                    EXPECT_APPROX_EQ(tgt_v(r, k), expected, 1.e-12);
+                }
+            }
+        }
+    }
+}
+
 }  // namespace test
 }  // namespace atlas
 
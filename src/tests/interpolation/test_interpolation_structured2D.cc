@@ -393,6 +393,57 @@ CASE("test_interpolation_structured using fs API for fieldset (Value=float)") {
     test_interpolation_structured_using_fs_API_for_fieldset<float>();
 }
 
+CASE("test_interpolation_structured matrix free versus matrix") {
+    Grid input_grid(input_gridname("O32"));
+    Grid output_grid(output_gridname("O64"));
+
+    for (std::string type : {"structured-linear2D", "structured-cubic2D", "structured-quasicubic2D"}) {
+        SECTION(type) {
+            StructuredColumns input_fs(input_grid, option::halo(2) | option::levels(4));
+            NodeColumns output_fs(MeshGenerator("structured").generate(output_grid));
+
+            auto lonlat = array::make_view<double, 2>(input_fs.xy());
+
+            Field source_1d = input_fs.createField<double>(option::name("1d") | option::levels(0));
+            Field source_2d = input_fs.createField<double>(option::name("2d"));
+            auto src_1d     = array::make_view<double, 1>(source_1d);
+            auto src_2d     = array::make_view<double, 2>(source_2d);
+            for (idx_t n = 0; n < input_fs.size(); ++n) {
+                src_1d(n) = util::function::vortex_rollup(lonlat(n, LON), lonlat(n, LAT), 1.);
+                for (idx_t k = 0; k < 4; ++k) {
+                    src_2d(n, k) = util::function::vortex_rollup(lonlat(n, LON), lonlat(n, LAT), 0.5 + double(k) / 2);
+                }
+            }
+
+            auto interpolate = [&](bool matrix_free, Field& target_1d, Field& target_2d) {
+                Interpolation interpolation(Config("type", type) | Config("matrix_free", matrix_free), input_fs,
+                                            output_fs);
+                target_1d = output_fs.createField<double>(option::name("1d"));
+                target_2d = output_fs.createField<double>(option::name("2d") | option::levels(4));
+                array::make_view<double, 1>(target_1d).assign(0.);
+                array::make_view<double, 2>(target_2d).assign(0.);
+                interpolation.execute(source_1d, target_1d);
+                interpolation.execute(source_2d, target_2d);
+            };
+
+            Field matrix_1d, matrix_2d, matrix_free_1d, matrix_free_2d;
+            interpolate(false, matrix_1d, matrix_2d);
+            interpolate(true, matrix_free_1d, matrix_free_2d);
+
+            auto m_1d  = array::make_view<double, 1>(matrix_1d);
+            auto m_2d  = array::make_view<double, 2>(matrix_2d);
+            auto mf_1d = array::make_view<double, 1>(matrix_free_1d);
+            auto mf_2d = array::make_view<double, 2>(matrix_free_2d);
+            for (idx_t n = 0; n < output_fs.size(); ++n) {
+                EXPECT_APPROX_EQ(mf_1d(n), m_1d(n), 1.e-12);
+                for (idx_t k = 0; k < 4; ++k) {
+                    EXPECT_APPROX_EQ(mf_2d(n, k), m_2d(n, k), 1.e-12);
+                }
+            }
+        }
+    }
+}
+
 
 /// @brief Compute magnitude of flow with rotation-angle beta
 /// (beta=0 --> zonal, beta=pi/2 --> meridional)
@@ -8,6 +8,7 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
 #include <tuple>
 #include <vector>
 
@@ -328,6 +329,124 @@ CASE("sparse_matrix matrix multiply (spmm)") {
     }
 }
 
+CASE("sparse_matrix transposed multiply-add") {
+    // A =  2  . -3
+    //      .  2  .
+    //      .  .  2
+    // x = 1 2 3
+    // y = 1 1 1
+    SparseMatrix A{3, 3, {{0, 0, 2.}, {0, 2, -3.}, {1, 1, 2.}, {2, 2, 2.}}};
+
+    SECTION("View of atlas::Array") {
+        ArrayVector<double> x(Vector{1., 2., 3.});
+        ArrayVector<double> y(Vector{1., 1., 1.});
+        sparse_matrix_multiply_add_transpose(A, x.view(), y.view());
+        expect_equal(y.view(), Vector{3., 5., 4.});
+    }
+
+    SECTION("View of atlas::Array PointsLeft and PointsRight") {
+        Matrix m{{1., 2.}, {3., 4.}, {5., 6.}};
+        Matrix c_exp{{2., 4.}, {6., 8.}, {7., 6.}};
+        ArrayMatrix<float> ml(m);
+        ArrayMatrix<float> cl(3, 2);
+        cl.view().assign(0.);
+        sparse_matrix_multiply_add_transpose(A, ml.view(), cl.view());
+        expect_equal(cl.view(), ArrayMatrix<float>(c_exp).view());
+
+        ArrayMatrix<double, Indexing::layout_right> mr(m);
+        ArrayMatrix<double, Indexing::layout_right> cr(3, 2);
+        cr.view().assign(0.);
+        sparse_matrix_multiply_add_transpose(A, mr.view(), cr.view(), Indexing::layout_right);
+        expect_equal(cr.view(), ArrayMatrix<double, Indexing::layout_right>(c_exp).view());
+    }
+
+    SECTION("compare with explicit transpose, scattered columns") {
+        const size_t rows = 1000;
+        const size_t cols = 300;
+        std::vector<eckit::linalg::Triplet> triplets;
+        for (size_t r = 0; r < rows; ++r) {
+            triplets.emplace_back(r, (r * 7) % cols, 1. + r % 3);
+            triplets.emplace_back(r, (r * 13 + 5) % cols, 0.5);
+        }
+        SparseMatrix B(rows, cols, triplets);
+        SparseMatrix Bt(B);
+        Bt.transpose();
+
+        Vector x(rows);
+        for (size_t r = 0; r < rows; ++r) {
+            x[r] = 0.01 * r;
+        }
+        Vector y_exp(cols);
+        sparse_matrix_multiply(Bt, x, y_exp, sparse::backend::openmp());
+
+        ArrayVector<double> y(cols);
+        y.view().assign(0.);
+        sparse_matrix_multiply_add_transpose(B, ArrayVector<double>(x).view(), y.view());
+        expect_equal(y.view(), y_exp);
+    }
+
+    SECTION("compare with explicit transpose, banded columns") {
+        const size_t rows = 1000;
+        const size_t cols = 400;
+        std::vector<eckit::linalg::Triplet> triplets;
+        for (size_t r = 0; r < rows; ++r) {
+            const size_t n = (r * cols) / rows;
+            triplets.emplace_back(r, n, 1. + r % 3);
+            triplets.emplace_back(r, std::min(n + 1, cols - 1), 0.5);
+        }
+        SparseMatrix B(rows, cols, triplets);
+        SparseMatrix Bt(B);
+        Bt.transpose();
+
+        Matrix x(rows, 2);
+        for (size_t r = 0; r < rows; ++r) {
+            x(r, 0) = 0.01 * r;
+            x(r, 1) = 1. - 0.001 * r;
+        }
+        ArrayMatrix<double> y_exp(cols, 2);
+        sparse_matrix_multiply(Bt, ArrayMatrix<double>(x).view(), y_exp.view(), sparse::backend::openmp());
+
+        ArrayMatrix<double> y(cols, 2);
+        y.view().assign(0.);
+        sparse_matrix_multiply_add_transpose(B, ArrayMatrix<double>(x).view(), y.view());
+        expect_equal(y.view(), y_exp.view());
+    }
+
+    SECTION("repeated application, and matrices of the same shape") {
+        // The analysis of the sparsity pattern is reused by repeated applications of the same matrix, and must not
+        // be reused for a different matrix of the same shape
+        const size_t rows = 1000;
+        const size_t cols = 300;
+        Vector x(rows);
+        for (size_t r = 0; r < rows; ++r) {
+            x[r] = 0.01 * r;
+        }
+        for (size_t stride : {7, 11}) {
+            std::vector<eckit::linalg::Triplet> triplets;
+            for (size_t r = 0; r < rows; ++r) {
+                triplets.emplace_back(r, (r * stride) % cols, 1. + r % 3);
+                triplets.emplace_back(r, (r * 13 + 5) % cols, 0.5);
+            }
+            SparseMatrix B(rows, cols, triplets);
+            SparseMatrix Bt(B);
+            Bt.transpose();
+
+            Vector y_exp(cols);
+            sparse_matrix_multiply(Bt, x, y_exp, sparse::backend::openmp());
+            for (size_t n = 0; n < cols; ++n) {
+                y_exp[n] *= 3.;
+            }
+
+            ArrayVector<double> y(cols);
+            y.view().assign(0.);
+            for (int i = 0; i < 3; ++i) {
+                sparse_matrix_multiply_add_transpose(B, ArrayVector<double>(x).view(), y.view());
+            }
+            expect_equal(y.view(), y_exp);
+        }
+    }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 
 }  // namespace test
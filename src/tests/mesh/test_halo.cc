@@ -10,14 +10,19 @@
 
 #include <algorithm>
 #include <iomanip>
+#include <map>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 #include "eckit/types/FloatCompare.h"
 
 #include "atlas/array.h"
 #include "atlas/array/ArrayView.h"
 #include "atlas/array/IndexView.h"
+#include "atlas/grid.h"
 #include "atlas/library/config.h"
+#include "atlas/mesh/HybridElements.h"
 #include "atlas/mesh/IsGhostNode.h"
 #include "atlas/mesh/Mesh.h"
 #include "atlas/mesh/Nodes.h"
@@ -26,10 +31,12 @@
 #include "atlas/mesh/actions/BuildHalo.h"
 #include "atlas/mesh/actions/BuildParallelFields.h"
 #include "atlas/mesh/actions/BuildPeriodicBoundaries.h"
+#include "atlas/meshgenerator.h"
 #include "atlas/output/Gmsh.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/util/CoordinateEnums.h"
 #include "atlas/util/MicroDeg.h"
+#include "atlas/util/Point.h"
 #include "atlas/util/Unique.h"
 
 #include "tests/AtlasTestEnvironment.h"
@@ -244,6 +251,90 @@ CASE("test_custom") {
     //  DEBUG("dual_normals checksum "<<checksum,0);
 }
 #endif
+
+//-----------------------------------------------------------------------------
+
+// Gather global indices and coordinates of all partitions. Check that equal global indices are given to equal
+// points only, that distinct points have distinct global indices, and that global indices are contiguous from 1.
+void check_global_index(const Field& global_index, const std::vector<PointXY>& points) {
+    auto glb_idx = array::make_view<gidx_t, 1>(global_index);
+    std::vector<gidx_t> local_glb_idx(glb_idx.size());
+    std::vector<double> local_xy;
+    for (idx_t j = 0; j < glb_idx.size(); ++j) {
+        local_glb_idx[j] = glb_idx(j);
+        local_xy.emplace_back(points[j].x());
+        local_xy.emplace_back(points[j].y());
+    }
+    const auto& comm = mpi::comm();
+    eckit::mpi::Buffer<gidx_t> all_glb_idx(comm.size());
+    eckit::mpi::Buffer<double> all_xy(comm.size());
+    comm.allGatherv(local_glb_idx.begin(), local_glb_idx.end(), all_glb_idx);
+    comm.allGatherv(local_xy.begin(), local_xy.end(), all_xy);
+
+    std::map<gidx_t, std::pair<int, int>> point_of_glb_idx;
+    std::map<std::pair<int, int>, gidx_t> glb_idx_of_point;
+    idx_t nb_mismatches = 0;
+    for (size_t j = 0; j < all_glb_idx.buffer.size(); ++j) {
+        const gidx_t g = all_glb_idx.buffer[j];
+        const std::pair<int, int> p{util::microdeg(all_xy.buffer[2 * j]), util::microdeg(all_xy.buffer[2 * j + 1])};
+        if (point_of_glb_idx.emplace(g, p).first->second != p) {
+            ++nb_mismatches;
+        }
+        if (glb_idx_of_point.emplace(p, g).first->second != g) {
+            ++nb_mismatches;
+        }
+    }
+    EXPECT_EQ(nb_mismatches, 0);
+    EXPECT_EQ(point_of_glb_idx.begin()->first, 1);
+    EXPECT_EQ(point_of_glb_idx.rbegin()->first, gidx_t(point_of_glb_idx.size()));
+}
+
+CASE("test_global_index_after_halo") {
+    Mesh mesh = StructuredMeshGenerator().generate(Grid("O16"));
+    mesh::actions::build_halo(mesh, 2);
+
+    SECTION("nodes") {
+        auto xy = array::make_view<double, 2>(mesh.nodes().xy());
+        std::vector<PointXY> points;
+        for (idx_t n = 0; n < mesh.nodes().size(); ++n) {
+            points.emplace_back(xy(n, XX), xy(n, YY));
+        }
+        check_global_index(mesh.nodes().global_index(), points);
+
+        // Every global index is owned by exactly one partition
+        auto glb_idx = array::make_view<gidx_t, 1>(mesh.nodes().global_index());
+        auto ghost   = array::make_view<int, 1>(mesh.nodes().ghost());
+        std::vector<gidx_t> owned;
+        for (idx_t n = 0; n < mesh.nodes().size(); ++n) {
+            if (not ghost(n)) {
+                owned.emplace_back(glb_idx(n));
+            }
+        }
+        eckit::mpi::Buffer<gidx_t> all_owned(mpi::comm().size());
+        mpi::comm().allGatherv(owned.begin(), owned.end(), all_owned);
+        std::vector<gidx_t> sorted(all_owned.buffer.begin(), all_owned.buffer.end());
+        std::sort(sorted.begin(), sorted.end());
+        EXPECT(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+        EXPECT_EQ(sorted.size(), size_t(mesh.grid().size()));
+    }
+
+    SECTION("cells") {
+        auto xy                = array::make_view<double, 2>(mesh.nodes().xy());
+        const auto& cell_nodes = mesh.cells().node_connectivity();
+        std::vector<PointXY> centroids;
+        for (idx_t c = 0; c < mesh.cells().size(); ++c) {
+            double x = 0.;
+            double y = 0.;
+            for (idx_t j = 0; j < cell_nodes.cols(c); ++j) {
+                x += xy(cell_nodes(c, j), XX);
+                y += xy(cell_nodes(c, j), YY);
+            }
+            centroids.emplace_back(x / cell_nodes.cols(c), y / cell_nodes.cols(c));
+        }
+        check_global_index(mesh.cells().global_index(), centroids);
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 }  // namespace test
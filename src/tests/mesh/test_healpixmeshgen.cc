@@ -8,6 +8,7 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include "atlas/array.h"
 #include "atlas/grid.h"
 #include "atlas/mesh/Mesh.h"
 #include "atlas/mesh/Nodes.h"
@@ -126,6 +127,35 @@ CASE("test_create_healpix_mesh") {
     Gmsh("out_ll.msh", util::Config("coordinates", "lonlat")).write(m);
 }
 
+CASE("test_partitioned_healpix_mesh") {
+    Grid grid("H8");
+    for (std::string pole_elements : {"quads", "pentagons"}) {
+        auto count_owned = [](const Mesh& mesh) {
+            auto ghost  = array::make_view<int, 1>(mesh.nodes().ghost());
+            idx_t owned = 0;
+            for (idx_t n = 0; n < ghost.size(); ++n) {
+                owned += ghost(n) ? 0 : 1;
+            }
+            return owned;
+        };
+
+        Mesh serial = MeshGenerator("healpix", util::Config("nb_parts", 1)("part", 0)("pole_elements", pole_elements))
+                          .generate(grid);
+
+        // Every node is owned by exactly one of the partition-local meshes
+        const int nb_parts = 4;
+        idx_t owned        = 0;
+        for (int part = 0; part < nb_parts; ++part) {
+            Mesh mesh = MeshGenerator("healpix", util::Config("nb_parts", nb_parts)("part", part)(
+                                                     "partitioner", "equal_regions")("pole_elements", pole_elements))
+                            .generate(grid);
+            EXPECT(mesh.cells().size() > 0);
+            owned += count_owned(mesh);
+        }
+        EXPECT_EQ(owned, count_owned(serial));
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 CASE("construction by config") {
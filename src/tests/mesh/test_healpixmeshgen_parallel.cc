@@ -0,0 +1,91 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/array.h"
+#include "atlas/grid.h"
+#include "atlas/mesh/HybridElements.h"
+#include "atlas/mesh/Mesh.h"
+#include "atlas/mesh/Nodes.h"
+#include "atlas/meshgenerator.h"
+#include "atlas/parallel/mpi/mpi.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+idx_t count_owned(const Mesh& mesh) {
+    auto ghost  = array::make_view<int, 1>(mesh.nodes().ghost());
+    idx_t owned = 0;
+    for (idx_t n = 0; n < ghost.size(); ++n) {
+        owned += ghost(n) ? 0 : 1;
+    }
+    return owned;
+}
+
+CASE("test_distributed_healpix_mesh") {
+    Grid grid("H8");
+    const int nb_parts = static_cast<int>(mpi::size());
+    const int part     = static_cast<int>(mpi::rank());
+    for (std::string pole_elements : {"quads", "pentagons"}) {
+        SECTION(pole_elements) {
+            // Every task generates its own partition, and the rows of the partitions are found collectively
+            Mesh mesh = MeshGenerator("healpix", util::Config("pole_elements", pole_elements)).generate(grid);
+
+            // The same partition, generated by this task on its own
+            Mesh mesh_local = MeshGenerator("healpix", util::Config("nb_parts", nb_parts)("part", part)(
+                                                           "partitioner", "equal_regions")("pole_elements",
+                                                                                           pole_elements))
+                                  .generate(grid);
+
+            EXPECT_EQ(mesh.nodes().size(), mesh_local.nodes().size());
+            EXPECT_EQ(mesh.cells().size(), mesh_local.cells().size());
+            auto glb_idx       = array::make_view<gidx_t, 1>(mesh.nodes().global_index());
+            auto glb_idx_local = array::make_view<gidx_t, 1>(mesh_local.nodes().global_index());
+            for (idx_t n = 0; n < std::min(glb_idx.size(), glb_idx_local.size()); ++n) {
+                EXPECT_EQ(glb_idx(n), glb_idx_local(n));
+            }
+
+            // Every node is owned by exactly one partition
+            Mesh serial =
+                MeshGenerator("healpix", util::Config("nb_parts", 1)("part", 0)("pole_elements", pole_elements))
+                    .generate(grid);
+            idx_t owned = count_owned(mesh);
+            mpi::comm().allReduceInPlace(owned, eckit::mpi::sum());
+            EXPECT_EQ(owned, count_owned(serial));
+        }
+    }
+}
+
+CASE("test_healpix_mesh_generated_by_one_task") {
+    // With an explicit "part", a task generates partitions on its own, without collective communication
+    Grid grid("H8");
+    const int nb_parts = static_cast<int>(mpi::size());
+    if (mpi::rank() == 0) {
+        for (int part = 0; part < nb_parts; ++part) {
+            Mesh mesh = MeshGenerator("healpix", util::Config("nb_parts", nb_parts)("part", part)("partitioner",
+                                                                                                  "equal_regions"))
+                            .generate(grid);
+            EXPECT(mesh.cells().size() > 0);
+        }
+    }
+    mpi::comm().barrier();
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
@@ -8,8 +8,14 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "atlas/array.h"
 #include "atlas/grid/Grid.h"
 #include "atlas/library/config.h"
+#include "atlas/mesh/Elements.h"
 #include "atlas/mesh/HybridElements.h"
 #include "atlas/mesh/Mesh.h"
 #include "atlas/mesh/actions/BuildEdges.h"
@@ -512,6 +518,63 @@ CASE("test_build_edges_triangles_only") {
 
 //-----------------------------------------------------------------------------
 
+// Compare the parallel sort-based facet search with the serial node-to-facet search
+void expect_same_facets(const Mesh& mesh) {
+    std::vector<idx_t> facet_nodes, serial_facet_nodes;
+    std::vector<idx_t> facet_to_elem, serial_facet_to_elem;
+    std::vector<idx_t> halo_offsets, serial_halo_offsets;
+    idx_t nb_facets, serial_nb_facets;
+    idx_t nb_inner_facets, serial_nb_inner_facets;
+    idx_t missing_value, serial_missing_value;
+
+    mesh::detail::accumulate_facets_ordered_by_halo(mesh.cells(), mesh.nodes(), facet_nodes, facet_to_elem, nb_facets,
+                                                    nb_inner_facets, missing_value, halo_offsets);
+    mesh::detail::accumulate_facets_ordered_by_halo_serial(mesh.cells(), mesh.nodes(), serial_facet_nodes,
+                                                           serial_facet_to_elem, serial_nb_facets,
+                                                           serial_nb_inner_facets, serial_missing_value,
+                                                           serial_halo_offsets);
+
+    EXPECT_EQ(nb_facets, serial_nb_facets);
+    EXPECT_EQ(nb_inner_facets, serial_nb_inner_facets);
+    EXPECT_EQ(missing_value, serial_missing_value);
+    EXPECT(halo_offsets == serial_halo_offsets);
+    EXPECT(facet_nodes == serial_facet_nodes);
+    EXPECT(facet_to_elem == serial_facet_to_elem);
+}
+
+// Assign halo 0, 1 and 2 to consecutive thirds of the elements of each type
+void assign_halos(Mesh& mesh) {
+    auto halo = array::make_view<int, 1>(mesh.cells().halo());
+    for (idx_t t = 0; t < mesh.cells().nb_types(); ++t) {
+        const auto& elements = mesh.cells().elements(t);
+        const idx_t size     = elements.size();
+        for (idx_t e = 0; e < size; ++e) {
+            halo(elements.begin() + e) = (3 * e) / std::max<idx_t>(size, 1);
+        }
+    }
+}
+
+CASE("test_accumulate_facets_parallel_vs_serial") {
+    for (bool triangulate : {false, true}) {
+        SECTION(std::string("O8 with halos") + (triangulate ? ", triangulated" : "")) {
+            Mesh mesh = StructuredMeshGenerator(Config("triangulate", triangulate)).generate(Grid("O8"));
+            assign_halos(mesh);
+            expect_same_facets(mesh);
+        }
+    }
+    SECTION("O8 with halos and a collapsed facet") {
+        Mesh mesh = StructuredMeshGenerator(Config("triangulate", false)).generate(Grid("O8"));
+        assign_halos(mesh);
+        auto& quads = mesh.cells().elements(0);
+        EXPECT(quads.size() > 10);
+        auto& quad_nodes = quads.node_connectivity();
+        quad_nodes.set(10, 3, quad_nodes(10, 0));
+        expect_same_facets(mesh);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 CASE("test_pole_edge_default") {
     auto pole_edges = [](const Grid& grid) {
         auto mesh = StructuredMeshGenerator().generate(grid);
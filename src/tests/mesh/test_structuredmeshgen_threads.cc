@@ -0,0 +1,110 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <string>
+
+#include "atlas/array.h"
+#include "atlas/grid.h"
+#include "atlas/mesh/HybridElements.h"
+#include "atlas/mesh/Mesh.h"
+#include "atlas/mesh/Nodes.h"
+#include "atlas/meshgenerator.h"
+#include "atlas/parallel/omp/omp.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+Mesh generate(const Grid& grid, const util::Config& config, int nb_threads) {
+    const int max_threads = atlas_omp_get_max_threads();
+    atlas_omp_set_num_threads(nb_threads);
+    Mesh mesh = MeshGenerator("structured", config).generate(grid);
+    atlas_omp_set_num_threads(max_threads);
+    return mesh;
+}
+
+void expect_identical(const Mesh& a, const Mesh& b) {
+    EXPECT_EQ(a.nodes().size(), b.nodes().size());
+    EXPECT_EQ(a.cells().size(), b.cells().size());
+    if (a.nodes().size() != b.nodes().size() || a.cells().size() != b.cells().size()) {
+        return;
+    }
+
+    auto a_glb_idx = array::make_view<gidx_t, 1>(a.nodes().global_index());
+    auto b_glb_idx = array::make_view<gidx_t, 1>(b.nodes().global_index());
+    auto a_part    = array::make_view<int, 1>(a.nodes().partition());
+    auto b_part    = array::make_view<int, 1>(b.nodes().partition());
+    auto a_ghost   = array::make_view<int, 1>(a.nodes().ghost());
+    auto b_ghost   = array::make_view<int, 1>(b.nodes().ghost());
+    auto a_xy      = array::make_view<double, 2>(a.nodes().xy());
+    auto b_xy      = array::make_view<double, 2>(b.nodes().xy());
+    idx_t node_mismatches = 0;
+    for (idx_t n = 0; n < a.nodes().size(); ++n) {
+        if (a_glb_idx(n) != b_glb_idx(n) || a_part(n) != b_part(n) || a_ghost(n) != b_ghost(n) ||
+            a_xy(n, 0) != b_xy(n, 0) || a_xy(n, 1) != b_xy(n, 1)) {
+            ++node_mismatches;
+        }
+    }
+    EXPECT_EQ(node_mismatches, 0);
+
+    auto a_cell_glb_idx = array::make_view<gidx_t, 1>(a.cells().global_index());
+    auto b_cell_glb_idx = array::make_view<gidx_t, 1>(b.cells().global_index());
+    const auto& a_conn  = a.cells().node_connectivity();
+    const auto& b_conn  = b.cells().node_connectivity();
+    idx_t cell_mismatches = 0;
+    for (idx_t c = 0; c < a.cells().size(); ++c) {
+        bool same = a_cell_glb_idx(c) == b_cell_glb_idx(c) && a_conn.cols(c) == b_conn.cols(c);
+        for (idx_t j = 0; same && j < a_conn.cols(c); ++j) {
+            same = a_conn(c, j) == b_conn(c, j);
+        }
+        if (not same) {
+            ++cell_mismatches;
+        }
+    }
+    EXPECT_EQ(cell_mismatches, 0);
+}
+
+//-----------------------------------------------------------------------------
+
+CASE("test_structured_meshgen_thread_independence") {
+    const int nb_threads = std::max(4, atlas_omp_get_max_threads());
+
+    // With many equal_regions partitions, the first pair of latitudes of some partitions has no elements,
+    // so that region.north is moved south and the rows of elements are compacted.
+    const int nb_parts = 16;
+
+    for (std::string gridname : {"O32", "L32x17", "N24"}) {
+        for (bool triangulate : {false, true}) {
+            SECTION(gridname + (triangulate ? " triangulated" : "")) {
+                Grid grid(gridname);
+                for (int part = 0; part < nb_parts; ++part) {
+                    auto config = util::Config("nb_parts", nb_parts)("part", part)("partitioner", "equal_regions")(
+                        "triangulate", triangulate);
+                    Mesh serial   = generate(grid, config, 1);
+                    Mesh threaded = generate(grid, config, nb_threads);
+                    expect_identical(serial, threaded);
+                }
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
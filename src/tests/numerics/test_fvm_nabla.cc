@@ -11,6 +11,8 @@
 #include <cmath>
 #include <iomanip>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include "eckit/config/Resource.h"
 
@@ -275,6 +277,68 @@ CASE("test_grad") {
 }
 
 
+CASE("test_grad_fieldset") {
+    auto radius = option::radius("Earth");
+    Grid grid(griduid());
+    MeshGenerator meshgenerator("structured");
+    Mesh mesh = meshgenerator.generate(grid, Distribution(grid, Partitioner("equal_regions")));
+    fvm::Method fvm(mesh, radius | option::levels(test_levels()));
+    Nabla nabla(fvm);
+    Nabla fused_nabla(fvm, util::Config("fused", true));
+
+    idx_t nnodes = fvm.node_columns().nb_nodes();
+    idx_t nlev   = std::max(1, test_levels());
+
+    const std::vector<double> betas{0., M_PI_2 * 0.25, M_PI_2 * 0.5, M_PI_2 * 0.75};
+
+    auto do_test = [&](auto value, double tolerance) {
+        using Value = std::decay_t<decltype(value)>;
+        FieldSet scalars;
+        FieldSet grads;
+        FieldSet fused_grads;
+        FieldSet expected_grads;
+        for (size_t j = 0; j < betas.size(); ++j) {
+            std::string name = "scalar" + std::to_string(j);
+            scalars.add(fvm.node_columns().createField<Value>(option::name(name)));
+            grads.add(fvm.node_columns().createField<Value>(option::name(name + "_grad") | option::variables(2)));
+            fused_grads.add(
+                fvm.node_columns().createField<Value>(option::name(name + "_fused_grad") | option::variables(2)));
+            expected_grads.add(
+                fvm.node_columns().createField<Value>(option::name(name + "_expected_grad") | option::variables(2)));
+            rotated_flow_magnitude<Value>(fvm, scalars[j], betas[j]);
+            nabla.gradient(scalars[j], expected_grads[j]);
+        }
+
+        // Repeated calls reuse the edge workspace of each Nabla
+        for (int iter = 0; iter < 2; ++iter) {
+            nabla.gradient(scalars, grads);
+            fused_nabla.gradient(scalars, fused_grads);
+        }
+
+        for (idx_t j = 0; j < scalars.size(); ++j) {
+            const auto expected = make_vectorview<Value>(expected_grads[j]);
+            const auto grad     = make_vectorview<Value>(grads[j]);
+            const auto fused    = make_vectorview<Value>(fused_grads[j]);
+            for (idx_t jnode = 0; jnode < nnodes; ++jnode) {
+                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                    for (idx_t jvar = 0; jvar < 2; ++jvar) {
+                        EXPECT(grad(jnode, jlev, jvar) == expected(jnode, jlev, jvar));
+                        EXPECT_APPROX_EQ(double(fused(jnode, jlev, jvar)), double(expected(jnode, jlev, jvar)),
+                                         tolerance);
+                    }
+                }
+            }
+        }
+    };
+    SECTION("double precision") {
+        do_test(double{}, 1.e-18);
+    }
+    SECTION("single precision") {
+        do_test(float{}, 1.e-10);
+    }
+}
+
+
 CASE("test_div") {
     const double radius = util::Earth::radius();
     //  const double radius = 1.;
@@ -12,6 +12,9 @@
 #include <cmath>
 #include <memory>
 #include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include "hic/hic.h"
 
@@ -705,6 +708,166 @@ void test_rank1_cinterface(Fixture& f) {
     }
 }
 
+void test_multiple_arrays(Fixture& f) {
+    // exchange a rank-1 float array and a rank-2 POD array together in a single round of messages
+    array::ArrayT<float> arr1(f.N);
+    array::ArrayT<POD> arr2(f.N, 2);
+    array::ArrayView<float, 1> arrv1 = array::make_host_view<float, 1>(arr1);
+    array::ArrayView<POD, 2> arrv2   = array::make_host_view<POD, 2>(arr2);
+    for (int j = 0; j < f.N; ++j) {
+        arrv1(j)    = (size_t(f.part[j]) != mpi::comm().rank() ? 0 : f.gidx[j]);
+        arrv2(j, 0) = (size_t(f.part[j]) != mpi::comm().rank() ? 0 : f.gidx[j] * 10);
+        arrv2(j, 1) = (size_t(f.part[j]) != mpi::comm().rank() ? 0 : f.gidx[j] * 100);
+    }
+
+    if (f.on_device) {
+        arr1.updateDevice();
+        arr2.updateDevice();
+    }
+
+    f.halo_exchange.execute({&arr1, &arr2}, f.on_device);
+
+    if (f.on_device) {
+        arr1.updateHost();
+        arr2.updateHost();
+    }
+
+    switch (mpi::comm().rank()) {
+        case 0: {
+            float arr1_c[] = {9, 1, 2, 3, 4};
+            POD arr2_c[]   = {90, 900, 10, 100, 20, 200, 30, 300, 40, 400};
+            validate<float, 1>::apply(arrv1, arr1_c);
+            validate<POD, 2>::apply(arrv2, arr2_c);
+            break;
+        }
+        case 1: {
+            float arr1_c[] = {3, 4, 5, 6, 7, 8};
+            POD arr2_c[]   = {30, 300, 40, 400, 50, 500, 60, 600, 70, 700, 80, 800};
+            validate<float, 1>::apply(arrv1, arr1_c);
+            validate<POD, 2>::apply(arrv2, arr2_c);
+            break;
+        }
+        case 2: {
+            float arr1_c[] = {5, 6, 7, 8, 9, 1, 2};
+            POD arr2_c[]   = {50, 500, 60, 600, 70, 700, 80, 800, 90, 900, 10, 100, 20, 200};
+            validate<float, 1>::apply(arrv1, arr1_c);
+            validate<POD, 2>::apply(arrv2, arr2_c);
+            break;
+        }
+    }
+}
+
+void test_start_finish(Fixture& f) {
+    array::ArrayT<POD> arr(f.N, 2);
+    array::ArrayView<POD, 2> arrv = array::make_host_view<POD, 2>(arr);
+    for (int j = 0; j < f.N; ++j) {
+        arrv(j, 0) = (size_t(f.part[j]) != mpi::comm().rank() ? 0 : f.gidx[j] * 10);
+        arrv(j, 1) = (size_t(f.part[j]) != mpi::comm().rank() ? 0 : f.gidx[j] * 100);
+    }
+
+    bool finished = false;
+    auto handle   = f.halo_exchange.start(arr);
+    handle.on_finish([&finished]() { finished = true; });
+    EXPECT(handle.active());
+    EXPECT(not finished);
+
+    f.halo_exchange.finish(handle);
+    EXPECT(not handle.active());
+    EXPECT(finished);
+
+    switch (mpi::comm().rank()) {
+        case 0: {
+            POD arr_c[] = {90, 900, 10, 100, 20, 200, 30, 300, 40, 400};
+            validate<POD, 2>::apply(arrv, arr_c);
+            break;
+        }
+        case 1: {
+            POD arr_c[] = {30, 300, 40, 400, 50, 500, 60, 600, 70, 700, 80, 800};
+            validate<POD, 2>::apply(arrv, arr_c);
+            break;
+        }
+        case 2: {
+            POD arr_c[] = {50, 500, 60, 600, 70, 700, 80, 800, 90, 900, 10, 100, 20, 200};
+            validate<POD, 2>::apply(arrv, arr_c);
+            break;
+        }
+    }
+}
+
+void test_drop_active_handle(Fixture& f) {
+    array::ArrayT<POD> arr(f.N, 2);
+    array::ArrayView<POD, 2> arrv = array::make_host_view<POD, 2>(arr);
+    for (int j = 0; j < f.N; ++j) {
+        arrv(j, 0) = (size_t(f.part[j]) != mpi::comm().rank() ? 0 : f.gidx[j] * 10);
+        arrv(j, 1) = (size_t(f.part[j]) != mpi::comm().rank() ? 0 : f.gidx[j] * 100);
+    }
+
+    // Drop a started exchange without finishing it, as when an exception unwinds the stack
+    bool finished = false;
+    try {
+        auto handle = f.halo_exchange.start(arr);
+        handle.on_finish([&finished]() { finished = true; });
+        EXPECT(handle.active());
+        throw std::runtime_error("dropping active handle");
+    }
+    catch (const std::runtime_error&) {
+    }
+    EXPECT(not finished);
+
+    // A handle that is moved from is no longer active, and assigning to an active handle waits for its messages
+    auto handle = f.halo_exchange.start(arr);
+    auto moved  = std::move(handle);
+    EXPECT(not handle.active());
+    EXPECT(moved.active());
+    moved = f.halo_exchange.start(arr);
+    EXPECT(moved.active());
+    f.halo_exchange.finish(moved);
+
+    // The buffers returned to the pool by the dropped handles are reused by the following exchanges
+    for (int i = 0; i < 3; ++i) {
+        test_start_finish(f);
+        test_multiple_arrays(f);
+    }
+}
+
+void test_many_layouts(Fixture& f) {
+    // Each number of variables is a different layout; only the buffers of the most recent layouts are retained
+    const int nb_layouts = static_cast<int>(parallel::HaloExchange::max_pooled_layouts()) + 4;
+    for (int nvar = 1; nvar <= nb_layouts; ++nvar) {
+        array::ArrayT<POD> arr(f.N, nvar);
+        array::ArrayView<POD, 2> arrv = array::make_host_view<POD, 2>(arr);
+        for (int j = 0; j < f.N; ++j) {
+            for (int v = 0; v < nvar; ++v) {
+                arrv(j, v) = (size_t(f.part[j]) != mpi::comm().rank() ? 0 : f.gidx[j] * (v + 1));
+            }
+        }
+
+        f.halo_exchange.execute({&arr});
+        EXPECT(f.halo_exchange.pooled_layouts() <= parallel::HaloExchange::max_pooled_layouts());
+
+        std::vector<POD> gidx_c;
+        switch (mpi::comm().rank()) {
+            case 0:
+                gidx_c = {9, 1, 2, 3, 4};
+                break;
+            case 1:
+                gidx_c = {3, 4, 5, 6, 7, 8};
+                break;
+            case 2:
+                gidx_c = {5, 6, 7, 8, 9, 1, 2};
+                break;
+        }
+        std::vector<POD> arr_c;
+        for (POD g : gidx_c) {
+            for (int v = 0; v < nvar; ++v) {
+                arr_c.emplace_back(g * (v + 1));
+            }
+        }
+        validate<POD, 2>::apply(arrv, arr_c.data());
+    }
+    EXPECT_EQ(f.halo_exchange.pooled_layouts(), parallel::HaloExchange::max_pooled_layouts());
+}
+
 CASE("test_haloexchange") {
     Fixture f;
 
@@ -731,6 +894,22 @@ CASE("test_haloexchange") {
     SECTION("test_rank2_paralleldim_2") { test_rank2_paralleldim2(f); }
 
     SECTION("test_rank1_cinterface") { test_rank1_cinterface(f); }
+
+    SECTION("test_multiple_arrays") { test_multiple_arrays(f); }
+
+    SECTION("test_start_finish") { test_start_finish(f); }
+
+    SECTION("test_reuse_buffers") {
+        for (int i = 0; i < 3; ++i) {
+            test_rank1(f);
+            test_multiple_arrays(f);
+            test_start_finish(f);
+        }
+    }
+
+    SECTION("test_drop_active_handle") { test_drop_active_handle(f); }
+
+    SECTION("test_many_layouts") { test_many_layouts(f); }
 }
 
 #if ATLAS_HAVE_GPU
@@ -766,6 +945,8 @@ CASE("test_haloexchange on device") {
     SECTION("test_rank2") { test_rank2(f); }
 
     SECTION("test_rank0_wrap") { test_rank0_wrap(f); }
+
+    SECTION("test_multiple_arrays") { test_multiple_arrays(f); }
 }
 #endif
 
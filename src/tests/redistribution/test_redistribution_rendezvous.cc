@@ -0,0 +1,129 @@
+/*
+ * (C) Crown Copyright 2021 Met Office
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+// Tests for the setup of RedistributeGeneric, which matches the owners of each unique ID (UID) on a rendezvous
+// rank chosen by hashing the UID. Covered are ranks that own no points at all, and UIDs that are present on several
+// ranks as halo (ghost) copies, of which only the owned copy takes part in the matching.
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "atlas/array.h"
+#include "atlas/field/Field.h"
+#include "atlas/functionspace/PointCloud.h"
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/redistribution/Redistribution.h"
+#include "atlas/util/Config.h"
+#include "atlas/util/CoordinateEnums.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+namespace atlas {
+namespace test {
+
+double testPattern(double lon, double lat) {
+    return std::cos(lon * M_PI / 180.) * std::cos(2. * lat * M_PI / 180.);
+}
+
+// PointCloud holding all points of the grid on rank "root", and no points on other ranks
+FunctionSpace pointCloudOnRank(const Grid& grid, int root) {
+    const idx_t size = (mpi::rank() == root) ? grid.size() : 0;
+    Field lonlat("lonlat", array::make_datatype<double>(), array::make_shape(size, 2));
+    auto view = array::make_view<double, 2>(lonlat);
+    if (size > 0) {
+        idx_t j = 0;
+        for (auto p : grid.lonlat()) {
+            view(j, LON) = p.lon();
+            view(j, LAT) = p.lat();
+            ++j;
+        }
+    }
+    return functionspace::PointCloud(lonlat);
+}
+
+// Redistribute the test pattern from source to target, and check the owned points of the target
+void checkRedistribution(const FunctionSpace& source, const FunctionSpace& target) {
+    auto redistribution = Redistribution(source, target);
+    EXPECT_EQ(redistribution.get()->type(), "RedistributeGeneric");
+
+    auto sourceField = source.createField<double>();
+    auto targetField = target.createField<double>();
+
+    const auto sourceLonLat = array::make_view<double, 2>(source.lonlat());
+    auto sourceView         = array::make_view<double, 1>(sourceField);
+    for (idx_t j = 0; j < sourceView.size(); ++j) {
+        sourceView(j) = testPattern(sourceLonLat(j, LON), sourceLonLat(j, LAT));
+    }
+    array::make_view<double, 1>(targetField).assign(-999.);
+
+    redistribution.execute(sourceField, targetField);
+
+    const auto targetLonLat = array::make_view<double, 2>(target.lonlat());
+    const auto targetGhost  = array::make_view<int, 1>(target.ghost());
+    const auto targetView   = array::make_view<double, 1>(targetField);
+    idx_t nbMismatches      = 0;
+    for (idx_t j = 0; j < targetView.size(); ++j) {
+        if (not targetGhost(j) &&
+            std::abs(targetView(j) - testPattern(targetLonLat(j, LON), targetLonLat(j, LAT))) > 1.e-12) {
+            ++nbMismatches;
+        }
+    }
+    EXPECT_EQ(nbMismatches, 0);
+}
+
+idx_t countGhosts(const FunctionSpace& functionspace) {
+    const auto ghost = array::make_view<int, 1>(functionspace.ghost());
+    idx_t nbGhosts   = 0;
+    for (idx_t j = 0; j < ghost.size(); ++j) {
+        nbGhosts += ghost(j) ? 1 : 0;
+    }
+    return nbGhosts;
+}
+
+//-----------------------------------------------------------------------------
+
+CASE("Ranks that send or receive nothing") {
+    const auto grid = Grid("O16");
+
+    // Halo points of the distributed PointCloud repeat UIDs owned by other ranks
+    const auto distributed = functionspace::PointCloud(grid, util::Config("halo_radius", 1000000.));
+    EXPECT(countGhosts(distributed) > 0);
+
+    for (int root : {0, static_cast<int>(mpi::size()) - 1}) {
+        SECTION("All points on rank " + std::to_string(root)) {
+            const auto onRank = pointCloudOnRank(grid, root);
+            checkRedistribution(onRank, distributed);
+            checkRedistribution(distributed, onRank);
+        }
+    }
+}
+
+CASE("UIDs repeated in halos of source and target") {
+    const auto grid = Grid("O16");
+
+    const auto source =
+        functionspace::StructuredColumns(grid, grid::Partitioner("equal_regions"), util::Config("halo", 2));
+    const auto target =
+        functionspace::StructuredColumns(grid, grid::Partitioner("equal_bands"), util::Config("halo", 1));
+    EXPECT(countGhosts(source) > 0);
+    EXPECT(countGhosts(target) > 0);
+
+    checkRedistribution(source, target);
+    checkRedistribution(target, source);
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
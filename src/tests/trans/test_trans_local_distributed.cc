@@ -0,0 +1,141 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "eckit/exception/Exceptions.h"
+
+#include "atlas/grid.h"
+#include "atlas/grid/Distribution.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/trans/local/TransLocal.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+std::vector<double> global_spectra(int trc) {
+    std::vector<double> sp((trc + 1) * (trc + 2));
+    int k = 0;
+    for (int jm = 0; jm <= trc; jm++) {
+        for (int jn = jm; jn <= trc; jn++) {
+            for (int imag = 0; imag < 2; imag++) {
+                // The zonal wavenumber jm == trc is ignored by TransLocal::invtrans
+                bool zero = (jm == trc) || (jm == 0 && imag == 1);
+                sp[k]     = zero ? 0. : std::sin(1. + k) / (1. + jn);
+                ++k;
+            }
+        }
+    }
+    return sp;
+}
+
+//-----------------------------------------------------------------------------
+
+CASE("test_trans_local_distributed") {
+    int trc = 31;
+    mpi::comm().split(mpi::rank(), "trans_local_self");
+
+    for (std::string gridname : {"F32", "O32"}) {
+        SECTION(gridname) {
+            Grid grid(gridname);
+            trans::TransLocal trans_serial(grid, trc, util::Config("mpi_comm", "trans_local_self"));
+            trans::TransLocal trans(grid, trc);
+
+            auto sp_glb = global_spectra(trc);
+            std::vector<double> gp_glb(grid.size());
+            trans_serial.invtrans(1, sp_glb.data(), gp_glb.data());
+
+            // local spectral data: coefficients of the local zonal wavenumbers in ascending order
+            std::vector<double> sp(trans.nb_spectral_coefficients());
+            size_t k = 0;
+            for (int jm : trans.zonal_wavenumbers()) {
+                size_t offset = (2 * trc + 3 - jm) * jm;
+                for (int j = 0; j < 2 * (trc + 1 - jm); ++j) {
+                    sp[k++] = sp_glb[offset + j];
+                }
+            }
+            EXPECT_EQ(k, sp.size());
+
+            auto distribution = trans.distribution();
+            EXPECT_EQ(distribution.nb_partitions(), idx_t(mpi::size()));
+            std::vector<double> gp(distribution.nb_pts()[mpi::rank()]);
+            trans.invtrans(1, sp.data(), gp.data());
+
+            double max_err = 0.;
+            size_t jgp     = 0;
+            for (gidx_t n = 0; n < grid.size(); ++n) {
+                if (distribution.partition(n) == int(mpi::rank())) {
+                    max_err = std::max(max_err, std::abs(gp[jgp++] - gp_glb[n]));
+                }
+            }
+            EXPECT_EQ(jgp, gp.size());
+            Log::info() << gridname << ": invtrans max error = " << max_err << std::endl;
+            EXPECT(max_err < 1.e-12);
+
+            std::vector<double> sp_dir(sp.size());
+            trans.dirtrans(1, gp.data(), sp_dir.data());
+            max_err = 0.;
+            for (size_t j = 0; j < sp.size(); ++j) {
+                max_err = std::max(max_err, std::abs(sp_dir[j] - sp[j]));
+            }
+            Log::info() << gridname << ": dirtrans max error = " << max_err << std::endl;
+            EXPECT(max_err < (gridname == "F32" ? 1.e-12 : 1.e-6));
+        }
+    }
+}
+
+CASE("test_trans_local_distributed_distribution") {
+    int trc = 31;
+    Grid grid("O32");
+    trans::TransLocal trans(grid, trc);
+
+    auto distribution = trans.distribution();
+    EXPECT_EQ(distribution.size(), grid.size());
+    EXPECT_EQ(distribution.nb_partitions(), idx_t(mpi::size()));
+
+    // Latitude bands are contiguous in the global numbering
+    StructuredGrid g(grid);
+    gidx_t n = 0;
+    for (idx_t j = 0; j < g.ny(); ++j) {
+        int p = distribution.partition(n);
+        for (idx_t i = 0; i < g.nx(j); ++i, ++n) {
+            EXPECT_EQ(distribution.partition(n), p);
+        }
+        if (n < grid.size()) {
+            EXPECT(distribution.partition(n) >= p);
+        }
+    }
+}
+
+CASE("test_trans_local_distributed_vordiv_not_implemented") {
+    int trc = 31;
+    Grid grid("O32");
+    trans::TransLocal trans(grid, trc);
+
+    std::vector<double> vor(trans.nb_spectral_coefficients(), 0.);
+    std::vector<double> div(trans.nb_spectral_coefficients(), 0.);
+    std::vector<double> gp(2 * trans.distribution().nb_pts()[mpi::rank()]);
+    EXPECT_THROWS_AS(trans.invtrans(0, nullptr, 1, vor.data(), div.data(), gp.data()), eckit::NotImplemented);
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
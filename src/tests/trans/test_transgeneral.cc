@@ -1815,6 +1815,120 @@ CASE("test_2level_adjoint_test_with_vortdiv") {
 #endif
 #endif
 
+CASE("test_trans_local_dirtrans") {
+    Log::info() << "test_trans_local_dirtrans" << std::endl;
+    // test the direct transform of TransLocal by transforming spectral data to a global Gaussian grid and back
+
+    int trc = 31;
+    for (std::string gridname : {"F32", "O32"}) {
+        // "OFF" uses discrete Fourier transforms instead of FFTW
+        for (std::string fft : {"FFTW", "OFF"}) {
+            SECTION(gridname + " fft=" + fft) {
+                Grid g(gridname);
+                trans::Trans transLocal(g, trc, option::type("local") | util::Config("fft", fft));
+
+                int nb_spec = (trc + 1) * (trc + 2);
+                std::vector<double> sp(nb_spec);
+                std::vector<double> sp_dir(nb_spec);
+                std::vector<double> gp(g.size());
+                int k = 0;
+                for (int jm = 0; jm <= trc; jm++) {
+                    for (int jn = jm; jn <= trc; jn++) {
+                        for (int imag = 0; imag < 2; imag++) {
+                            // The zonal wavenumber jm == trc is ignored by TransLocal::invtrans
+                            bool zero = (jm == trc) || (jm == 0 && imag == 1);
+                            sp[k]     = zero ? 0. : std::sin(1. + k) / (1. + jn);
+                            ++k;
+                        }
+                    }
+                }
+                transLocal.invtrans(1, sp.data(), gp.data());
+                transLocal.dirtrans(1, gp.data(), sp_dir.data());
+
+                double tolerance = (gridname == "F32" ? 1.e-12 : 1.e-6);
+                double max_err   = 0.;
+                for (int j = 0; j < nb_spec; ++j) {
+                    max_err = std::max(max_err, std::abs(sp[j] - sp_dir[j]));
+                }
+                Log::info() << gridname << " fft=" << fft << ": max error = " << max_err << std::endl;
+                EXPECT(max_err < tolerance);
+            }
+        }
+    }
+}
+
+CASE("test_trans_local_invtrans_float") {
+    Log::info() << "test_trans_local_invtrans_float" << std::endl;
+    // test the single precision inverse transform of TransLocal against the double precision one
+
+    int trc = 31;
+    for (std::string gridname : {"F32", "O32"}) {
+        SECTION(gridname) {
+            Grid g(gridname);
+            trans::Trans transLocal(g, trc, option::type("local"));
+
+            int nb_spec = (trc + 1) * (trc + 2);
+            std::vector<double> sp(nb_spec);
+            std::vector<double> gp(g.size());
+            Field spf("sp", array::make_datatype<float>(), array::make_shape(nb_spec));
+            Field gpf("gp", array::make_datatype<float>(), array::make_shape(g.size()));
+            auto spf_view = array::make_view<float, 1>(spf);
+            for (int k = 0; k < nb_spec; ++k) {
+                sp[k]       = std::sin(1. + k) / (1. + k);
+                spf_view(k) = static_cast<float>(sp[k]);
+            }
+            transLocal.invtrans(1, sp.data(), gp.data());
+
+            FieldSet spfields;
+            FieldSet gpfields;
+            spfields.add(spf);
+            gpfields.add(gpf);
+            transLocal.invtrans(spfields, gpfields);
+
+            auto gpf_view  = array::make_view<float, 1>(gpf);
+            double max_gp  = 0.;
+            double max_err = 0.;
+            for (idx_t j = 0; j < g.size(); ++j) {
+                max_gp  = std::max(max_gp, std::abs(gp[j]));
+                max_err = std::max(max_err, std::abs(gp[j] - gpf_view(j)));
+            }
+            Log::info() << gridname << ": max error = " << max_err << ", max value = " << max_gp << std::endl;
+            EXPECT(max_err < 1.e-5 * max_gp);
+        }
+    }
+}
+
+CASE("test_trans_local_precision_single") {
+    Log::info() << "test_trans_local_precision_single" << std::endl;
+    // test TransLocal set up for single precision only against the default TransLocal
+
+    int trc = 31;
+    for (std::string gridname : {"F32", "O32"}) {
+        SECTION(gridname) {
+            Grid g(gridname);
+            trans::TransLocal transDouble(g, trc);
+            trans::TransLocal transSingle(g, trc, util::Config("precision", "single"));
+
+            int nb_spec = (trc + 1) * (trc + 2);
+            std::vector<float> sp(nb_spec);
+            for (int k = 0; k < nb_spec; ++k) {
+                sp[k] = static_cast<float>(std::sin(1. + k) / (1. + k));
+            }
+            std::vector<float> gp_ref(g.size());
+            std::vector<float> gp(g.size());
+            transDouble.invtrans(1, sp.data(), gp_ref.data());
+            transSingle.invtrans(1, sp.data(), gp.data());
+            for (idx_t j = 0; j < g.size(); ++j) {
+                EXPECT_APPROX_EQ(double(gp[j]), double(gp_ref[j]), 1.e-5);
+            }
+
+            std::vector<double> sp_double(sp.begin(), sp.end());
+            std::vector<double> gp_double(g.size());
+            EXPECT_THROWS_AS(transSingle.invtrans(1, sp_double.data(), gp_double.data()), eckit::Exception);
+        }
+    }
+}
+
 #if 0
 CASE( "test_trans_fourier_truncation" ) {
     Log::info() << "test_trans_fourier_truncation" << std::endl;
@@ -266,6 +266,42 @@ CASE("test closestPointsWithinRadius") {
     EXPECT_EQ(neighbours, expected_neighbours);
 }
 
+CASE("test batched closestPoints") {
+    std::vector<PointLonLat> points;
+    for (double lat = -85.; lat <= 85.; lat += 17.) {
+        for (double lon = 0.; lon < 360.; lon += 23.) {
+            points.emplace_back(lon, lat);
+        }
+    }
+    const size_t n = points.size();
+    const size_t k = 4;
+    std::vector<idx_t> payloads(n * k);
+    std::vector<double> distances(n * k);
+    search().closestPoints(points.data(), n, k, payloads.data(), distances.data());
+    for (size_t i = 0; i < n; ++i) {
+        auto expected = search().closestPoints(points[i], k);
+        for (size_t j = 0; j < k; ++j) {
+            EXPECT_EQ(payloads[i * k + j], expected[j].payload());
+            EXPECT_APPROX_EQ(distances[i * k + j], expected[j].distance(), 1.e-12);
+        }
+    }
+
+    SECTION("with 3D points and without distances") {
+        std::vector<PointXYZ> xyz(n);
+        for (size_t i = 0; i < n; ++i) {
+            xyz[i] = make_xyz(points[i]);
+        }
+        std::vector<idx_t> payloads_xyz(n * k);
+        search().closestPoints(xyz.data(), n, k, payloads_xyz.data());
+        EXPECT_EQ(payloads_xyz, payloads);
+    }
+
+    SECTION("with more neighbours than points") {
+        std::vector<idx_t> too_many(search().size() + 1);
+        EXPECT_THROWS(search().closestPoints(points.data(), 1, search().size() + 1, too_many.data()));
+    }
+}
+
 CASE("test compatibility with external eckit KDTree") {
     // External world
     struct ExternalKDTreeTraits {